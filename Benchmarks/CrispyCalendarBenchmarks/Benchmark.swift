@@ -0,0 +1,182 @@
+//
+//  Benchmark.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+import Dispatch
+@testable import CrispyCalendar
+
+/// Named workload that is measured for every combination of input sizes and concurrently running threads.
+internal struct Benchmark {
+	/// Work prepared for a specific input size.
+	internal struct Workload {
+		/// Number of operations that are performed by a single `run` call.
+		internal let operationsCount: Int;
+		/// Work that is performed before every `run` call and is not measured.
+		internal let prepare: () -> ();
+		/// Measured work; it is executed concurrently by every thread and thus must be thread-safe.
+		internal let run: () -> ();
+		/// Estimated number of bytes that are retained by results of the last `run` call; it is not measured.
+		internal let retainedBytes: (() -> Int)?;
+		
+		internal init (operationsCount: Int, prepare: @escaping () -> () = {}, retainedBytes: (() -> Int)? = nil, run: @escaping () -> ()) {
+			self.operationsCount = operationsCount;
+			self.prepare = prepare;
+			self.retainedBytes = retainedBytes;
+			self.run = run;
+		}
+	}
+	
+	/// Result of a single benchmark measurement.
+	internal struct Result {
+		internal let name: String;
+		internal let size: Int;
+		internal let threadsCount: Int;
+		/// Number of operations performed by every thread.
+		internal let iterations: Int;
+		/// Wall clock time of a single operation, as observed by every thread.
+		internal let nanosecondsPerOperation: Double;
+		/// Estimated memory retained by result of a single operation, if the workload reports it.
+		internal let bytesPerOperation: Double?;
+	}
+	
+	internal let name: String;
+	internal let sizes: [Int];
+	internal let threadCounts: [Int];
+	private let makeWorkload: (Int) -> Workload;
+	
+	internal init (_ name: String, sizes: [Int], threadCounts: [Int] = [1], makeWorkload: @escaping (Int) -> Workload) {
+		self.name = name;
+		self.sizes = sizes;
+		self.threadCounts = threadCounts;
+		self.makeWorkload = makeWorkload;
+	}
+	
+	/// Measures the benchmark for every input size and threads count.
+	///
+	/// - Parameters:
+	///   - minimumDuration: Minimum total duration of measured work for every combination of parameters.
+	///   - handler: Block that receives measurement results as soon as they are available.
+	internal func run (minimumDuration: TimeInterval, handler: (Result) -> ()) {
+		let minimumNanoseconds = UInt64 (minimumDuration * 1e9);
+		for size in self.sizes {
+			let workload = self.makeWorkload (size);
+			workload.prepare ();
+			workload.run ();
+			
+			for threadsCount in self.threadCounts {
+				var elapsed = UInt64 (0), roundsCount = 0;
+				repeat {
+					workload.prepare ();
+					let start = DispatchTime.now ().uptimeNanoseconds;
+					if (threadsCount > 1) {
+						DispatchQueue.concurrentPerform (iterations: threadsCount) { _ in workload.run () };
+					} else {
+						workload.run ();
+					}
+					elapsed += DispatchTime.now ().uptimeNanoseconds - start;
+					roundsCount += 1;
+				} while (elapsed < minimumNanoseconds);
+				
+				let iterations = roundsCount * workload.operationsCount, bytesPerOperation = workload.retainedBytes.map { Double ($0 ()) / Double (workload.operationsCount) };
+				handler (Result (name: self.name, size: size, threadsCount: threadsCount, iterations: iterations, nanosecondsPerOperation: Double (elapsed) / Double (iterations), bytesPerOperation: bytesPerOperation));
+			}
+		}
+	}
+}
+
+/// Output format of benchmark results.
+internal enum BenchmarkOutputFormat: String {
+	/// One JSON object per line: `{"name": …, "size": …, "threads": …, "iterations": …, "ns_per_op": …}`, followed by `"bytes_per_op"`
+	/// for workloads that report retained memory.
+	case json;
+	/// Human-readable aligned columns.
+	case text;
+	
+	internal func header () -> String? {
+		switch (self) {
+		case .json:
+			return nil;
+		case .text:
+			return self.line (name: "name", size: "size", threadsCount: "threads", iterations: "iterations", nanosecondsPerOperation: "ns/op", bytesPerOperation: "bytes/op");
+		}
+	}
+	
+	internal func line (for result: Benchmark.Result) -> String {
+		switch (self) {
+		case .json:
+			let escapedName = result.name.replacingOccurrences (of: "\\", with: "\\\\").replacingOccurrences (of: "\"", with: "\\\"");
+			let bytesField = result.bytesPerOperation.map { ", \"bytes_per_op\": \(String (format: "%.1f", $0))" } ?? "";
+			return "{\"name\": \"\(escapedName)\", \"size\": \(result.size), \"threads\": \(result.threadsCount), \"iterations\": \(result.iterations), \"ns_per_op\": \(String (format: "%.3f", result.nanosecondsPerOperation))\(bytesField)}";
+		case .text:
+			let bytesPerOperation = result.bytesPerOperation.map { String (format: "%.1f", $0) } ?? "-";
+			return self.line (name: result.name, size: "\(result.size)", threadsCount: "\(result.threadsCount)", iterations: "\(result.iterations)", nanosecondsPerOperation: String (format: "%.3f", result.nanosecondsPerOperation), bytesPerOperation: bytesPerOperation);
+		}
+	}
+	
+	private func line (name: String, size: String, threadsCount: String, iterations: String, nanosecondsPerOperation: String, bytesPerOperation: String) -> String {
+		return [name.padding (toLength: 48, withPad: " ", startingAt: 0), size.leftPadded (to: 10), threadsCount.leftPadded (to: 8), iterations.leftPadded (to: 12), nanosecondsPerOperation.leftPadded (to: 14), bytesPerOperation.leftPadded (to: 12)].joined ();
+	}
+}
+
+/// Prevents the optimizer from removing computation of a value that is not used otherwise.
+@inline (never)
+@_optimize (none)
+internal func blackHole <T> (_ value: T) {}
+
+/* fileprivate */ extension String {
+	fileprivate func leftPadded (to length: Int) -> String {
+		return String (repeating: " ", count: max (length - self.count, 0)) + self;
+	}
+}
+
+/* internal */ extension Calendar {
+	/// Calendars that are measured by benchmarks of calendar-specific code paths: the arithmetic Gregorian one and a `Foundation`-backed one.
+	internal static let benchmarkedIdentifiers: [Calendar.Identifier] = [.gregorian, .hebrew];
+	
+	/// Returns a calendar with fixed locale and time zone, so that results do not depend on host settings.
+	///
+	/// - Parameters:
+	///   - identifier: Identifier of the calendar.
+	///   - minimumDaysInFirstWeek: Minimum number of days in the first week; distinct values produce distinct calendar wrappers.
+	internal static func benchmarkCalendar (_ identifier: Calendar.Identifier, minimumDaysInFirstWeek: Int? = nil) -> Calendar {
+		var result = Calendar (identifier: identifier);
+		result.locale = Locale (identifier: "en_US_POSIX");
+		result.timeZone = guarantee (TimeZone (identifier: "UTC"));
+		if let minimumDaysInFirstWeek = minimumDaysInFirstWeek {
+			result.minimumDaysInFirstWeek = minimumDaysInFirstWeek;
+		}
+		return result;
+	}
+}
+
+/* internal */ extension ContiguousArray {
+	/// Approximate heap size of array storage: object header, count and capacity words, followed by elements.
+	internal var benchmarkAllocatedBytes: Int {
+		return 32 + self.capacity * MemoryLayout <Element>.stride;
+	}
+}
+
+/* internal */ extension Date {
+	/// Fixed date that benchmarked units are started from: 2001-01-01 00:00:00 UTC.
+	internal static let benchmarkReferenceDate = Date (timeIntervalSinceReferenceDate: 0.0);
+}
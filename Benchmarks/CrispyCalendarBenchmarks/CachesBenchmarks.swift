@@ -0,0 +1,245 @@
+//
+//  CachesBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Purges of units caches that contain a number of values and concurrent lookups of cached values;
+	/// sizes are numbers of cached values.
+	internal static let caches: [Benchmark] = Calendar.benchmarkedIdentifiers.flatMap { identifier -> [Benchmark] in
+		let calendar = Calendar.benchmarkCalendar (identifier);
+		return [
+			Benchmark ("cache.purge.\(identifier)", sizes: [1024, 8192, 20480]) { size in
+				let day = CPCDay (containing: .benchmarkReferenceDate, calendar: calendar), calendarWrapper = calendar.wrapped ();
+				return Workload (operationsCount: 1, prepare: {
+					for offset in 0 ..< size {
+						blackHole (day.advanced (by: offset));
+					}
+				}, run: {
+					calendarWrapper.purgeCaches (factor: 0.5);
+				});
+			},
+			Benchmark ("cache.lookup.\(identifier)", sizes: [16, 1024, 20480], threadCounts: [1, 2, 4, 8]) { size in
+				let day = CPCDay (containing: .benchmarkReferenceDate, calendar: calendar), offsets = (0 ..< size).map { $0 * 7919 % size };
+				return Workload (operationsCount: size, prepare: {
+					for offset in offsets {
+						blackHole (day.advanced (by: offset));
+					}
+				}, run: {
+					for offset in offsets {
+						blackHole (day.cachedAdvancedUnit (by: offset));
+					}
+				});
+			},
+		];
+	};
+	
+	/// Sharded CLOCK cache of calendar wrappers compared side by side with the usage-counting cache it replaced;
+	/// sizes are numbers of cached values.
+	internal static let cachesComparison: [Benchmark] = Calendar.benchmarkedIdentifiers.flatMap { identifier -> [Benchmark] in
+		let calendar = Calendar.benchmarkCalendar (identifier), day = CPCDay (containing: .benchmarkReferenceDate, calendar: calendar);
+		let fillClockCache = { (size: Int) in
+			for offset in 0 ..< size {
+				day.cacheUnitValue (day, advancedBy: offset);
+			}
+		};
+		let fillUsageCountingCache = { (cache: BenchmarkUsageCountingCache <BenchmarkCacheKey, CPCDay>, size: Int) in
+			for offset in 0 ..< size {
+				cache [BenchmarkCacheKey (day, offset)] = day;
+			}
+		};
+		let makeUsageCountingCache = { (size: Int) -> BenchmarkUsageCountingCache <BenchmarkCacheKey, CPCDay> in
+			let result = BenchmarkUsageCountingCache <BenchmarkCacheKey, CPCDay> (capacity: 20480);
+			fillUsageCountingCache (result, size);
+			return result;
+		};
+		
+		return [
+			Benchmark ("cache.compare.clock.lookup.\(identifier)", sizes: [1024, 20480], threadCounts: [1, 4, 8]) { size in
+				let offsets = (0 ..< size).map { $0 * 7919 % size };
+				return Workload (operationsCount: size, prepare: {
+					day.calendarWrapper.purgeCaches (factor: 0.0);
+					fillClockCache (size);
+				}, run: {
+					for offset in offsets {
+						blackHole (day.cachedAdvancedUnit (by: offset));
+					}
+				});
+			},
+			Benchmark ("cache.compare.usageCounting.lookup.\(identifier)", sizes: [1024, 20480], threadCounts: [1, 4, 8]) { size in
+				let offsets = (0 ..< size).map { $0 * 7919 % size }, cache = makeUsageCountingCache (size);
+				return Workload (operationsCount: size) {
+					for offset in offsets {
+						blackHole (cache [BenchmarkCacheKey (day, offset)]);
+					}
+				};
+			},
+			Benchmark ("cache.compare.clock.insert.\(identifier)", sizes: [1024, 20480]) { size in
+				return Workload (operationsCount: size, prepare: { day.calendarWrapper.purgeCaches (factor: 0.0) }, run: { fillClockCache (size) });
+			},
+			Benchmark ("cache.compare.usageCounting.insert.\(identifier)", sizes: [1024, 20480]) { size in
+				var cache = makeUsageCountingCache (0);
+				return Workload (operationsCount: size, prepare: { cache = makeUsageCountingCache (0) }, run: { fillUsageCountingCache (cache, size) });
+			},
+			Benchmark ("cache.compare.clock.purge.\(identifier)", sizes: [1024, 20480]) { size in
+				return Workload (operationsCount: 1, prepare: {
+					day.calendarWrapper.purgeCaches (factor: 0.0);
+					fillClockCache (size);
+				}, run: {
+					day.calendarWrapper.purgeCaches (factor: 0.5);
+				});
+			},
+			Benchmark ("cache.compare.usageCounting.purge.\(identifier)", sizes: [1024, 20480]) { size in
+				var cache = makeUsageCountingCache (0);
+				return Workload (operationsCount: 1, prepare: { cache = makeUsageCountingCache (size) }, run: {
+					cache.purge (factor: 0.5);
+				});
+			},
+		];
+	};
+	
+	/// Wrapping of calendars and creation of units from many threads through public entry points, which wrap calendars;
+	/// sizes are numbers of distinct calendars that are used in turn.
+	internal static let calendarWrappers: [Benchmark] = [
+		Benchmark ("calendarWrapper.wrap", sizes: [1, 4, 16], threadCounts: [1, 4, 8]) { size in
+			let calendars = (0 ..< size).map { index -> Calendar in
+				var result = Calendar.benchmarkCalendar (.gregorian);
+				result.firstWeekday = index % 7 + 1;
+				result.minimumDaysInFirstWeek = index / 7 % 7 + 1;
+				return result;
+			};
+			let calendarWrappers = calendars.map { $0.wrapped () }, operationsCount = 16384;
+			return Workload (operationsCount: operationsCount) {
+				withExtendedLifetime (calendarWrappers) {
+					for index in 0 ..< operationsCount {
+						blackHole (calendars [index % size].wrapped ());
+					}
+				};
+			};
+		},
+		Benchmark ("calendarWrapper.currentUsed", sizes: [1], threadCounts: [1, 4, 8, 16]) { _ in
+			let operationsCount = 16384;
+			return Workload (operationsCount: operationsCount) {
+				for _ in 0 ..< operationsCount {
+					blackHole (CPCCalendarWrapper.currentUsed);
+				}
+			};
+		},
+		Benchmark ("calendarWrapper.unitsCreation", sizes: [1, 4], threadCounts: [1, 4, 8, 16]) { size in
+			let calendars = (0 ..< size).map { Calendar.benchmarkCalendar (Calendar.benchmarkedIdentifiers [$0 % Calendar.benchmarkedIdentifiers.count], minimumDaysInFirstWeek: $0 / 2 + 1) };
+			let calendarWrappers = calendars.map { $0.wrapped () }, dates = (0 ..< 64).map { Date.benchmarkReferenceDate.addingTimeInterval (Double ($0) * 86400.0) };
+			let operationsCount = 4096;
+			return Workload (operationsCount: operationsCount) {
+				withExtendedLifetime (calendarWrappers) {
+					for index in 0 ..< operationsCount {
+						let calendar = calendars [index % size];
+						switch (index % 3) {
+						case 0:
+							blackHole (CPCDay (containing: dates [index % dates.count], calendar: calendar));
+						case 1:
+							blackHole (CPCMonth.current (using: calendar));
+						default:
+							blackHole (CPCDay.today);
+						}
+					}
+				};
+			};
+		},
+	];
+}
+
+/// Key of cached values that mirrors keys of calendar units caches: a unit paired with a distance.
+private struct BenchmarkCacheKey: Hashable {
+	private let unit: CPCDay;
+	private let distance: Int;
+	
+	fileprivate init (_ unit: CPCDay, _ distance: Int) {
+		self.unit = unit;
+		self.distance = distance;
+	}
+}
+
+/// Usage-counting cache that preceded the sharded CLOCK cache, reproduced as a baseline: every lookup rewrites usage count
+/// of a value under an exclusive lock, and purge keeps values that were used at least `factor` times as often as the most used one.
+private final class BenchmarkUsageCountingCache <Key, Value> where Key: Hashable {
+	private final class Storage {
+		private struct ValueWrapper {
+			fileprivate let value: Value;
+			fileprivate let usageCount: Int;
+		}
+		
+		private var values: [Key: ValueWrapper];
+		
+		fileprivate init (capacity: Int) {
+			self.values = [:];
+			self.values.reserveCapacity (capacity);
+		}
+		
+		fileprivate subscript (key: Key) -> Value? {
+			get {
+				guard let value = self.values [key] else {
+					return nil;
+				}
+				
+				self.values [key] = ValueWrapper (value: value.value, usageCount: value.usageCount + 1);
+				return value.value;
+			}
+			set {
+				if let newValue = newValue {
+					self.values [key] = ValueWrapper (value: newValue, usageCount: 0);
+				} else {
+					self.values [key] = nil;
+				}
+			}
+		}
+		
+		fileprivate func purge (factor: Double) {
+			guard let maxUsageCount = self.values.max (by: { $0.value.usageCount < $1.value.usageCount })?.value.usageCount else {
+				return;
+			}
+			
+			let threshold = Int ((Double (maxUsageCount) * factor).rounded (.down));
+			let filteredValues = self.values.filter { $0.value.usageCount >= threshold };
+			self.values.removeAll (keepingCapacity: true);
+			for (key, value) in filteredValues {
+				self.values [key] = value;
+			}
+		}
+	}
+	
+	private var storage: UnfairThreadsafeStorage <Storage>;
+	
+	fileprivate init (capacity: Int) {
+		self.storage = UnfairThreadsafeStorage (Storage (capacity: capacity));
+	}
+	
+	fileprivate subscript (key: Key) -> Value? {
+		get { return self.storage.withMutableStoredValue { $0 [key] } }
+		set { self.storage.withMutableStoredValue { $0 [key] = newValue } }
+	}
+	
+	fileprivate func purge (factor: Double) {
+		self.storage.withMutableStoredValue { $0.purge (factor: factor) };
+	}
+}
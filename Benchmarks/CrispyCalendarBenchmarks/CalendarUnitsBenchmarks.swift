@@ -0,0 +1,154 @@
+//
+//  CalendarUnitsBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// `advanced (by:)` and `distance (to:)` of days and months; sizes are numbers of distinct offsets, so that
+	/// larger sizes exceed capacity of units caches.
+	internal static let calendarUnits: [Benchmark] = Calendar.benchmarkedIdentifiers.flatMap { identifier -> [Benchmark] in
+		let calendar = Calendar.benchmarkCalendar (identifier), threadCounts = [1, 4];
+		return [
+			Benchmark ("day.advanced.\(identifier)", sizes: [16, 1024, 65536], threadCounts: threadCounts) { size in
+				let day = CPCDay (containing: .benchmarkReferenceDate, calendar: calendar);
+				return Workload (operationsCount: size) {
+					for offset in 0 ..< size {
+						blackHole (day.advanced (by: offset));
+					}
+				};
+			},
+			Benchmark ("day.distance.\(identifier)", sizes: [16, 1024, 65536], threadCounts: threadCounts) { size in
+				let day = CPCDay (containing: .benchmarkReferenceDate, calendar: calendar), otherDays = (0 ..< size).map { day.advanced (by: $0) };
+				return Workload (operationsCount: size) {
+					for otherDay in otherDays {
+						blackHole (day.distance (to: otherDay));
+					}
+				};
+			},
+			Benchmark ("month.advanced.\(identifier)", sizes: [12, 240, 2400], threadCounts: threadCounts) { size in
+				let month = CPCMonth (containing: .benchmarkReferenceDate, calendar: calendar);
+				return Workload (operationsCount: size) {
+					for offset in 0 ..< size {
+						blackHole (month.advanced (by: offset));
+					}
+				};
+			},
+			Benchmark ("month.distance.\(identifier)", sizes: [12, 240, 2400], threadCounts: threadCounts) { size in
+				let month = CPCMonth (containing: .benchmarkReferenceDate, calendar: calendar), otherMonths = (0 ..< size).map { month.advanced (by: $0) };
+				return Workload (operationsCount: size) {
+					for otherMonth in otherMonths {
+						blackHole (month.distance (to: otherMonth));
+					}
+				};
+			},
+		];
+	};
+	
+	/// Enumeration of days through compound units subscripts (years, then months, then weeks); sizes are numbers of years.
+	internal static let compoundUnits: [Benchmark] = Calendar.benchmarkedIdentifiers.map { identifier in
+		let calendar = Calendar.benchmarkCalendar (identifier);
+		return Benchmark ("year.subscript.\(identifier)", sizes: [1, 10, 100], threadCounts: [1, 4]) { size in
+			let year = CPCYear (containing: .benchmarkReferenceDate, calendar: calendar), years = (0 ..< size).map { year.advanced (by: $0) };
+			let daysCount = years.lazy.flatMap { $0 }.flatMap { $0 }.reduce (0) { $0 + $1.count };
+			return Workload (operationsCount: daysCount) {
+				for year in years {
+					for month in year {
+						for week in month {
+							for day in week {
+								blackHole (day);
+							}
+						}
+					}
+				}
+			};
+		};
+	};
+	
+	/// Conversions between day numbers and Gregorian dates, performed arithmetically and by `Foundation`; sizes are numbers of consecutive days.
+	internal static let gregorianArithmetic: [Benchmark] = {
+		let calendar = Calendar.benchmarkCalendar (.gregorian), sizes = [1024, 65536];
+		let firstDayNumber = calendar.dayNumber (of: .benchmarkReferenceDate);
+		
+		return [
+			Benchmark ("gregorian.dayFromDayNumber.arithmetic", sizes: sizes) { size in
+				return Workload (operationsCount: size) {
+					for dayNumber in firstDayNumber ..< firstDayNumber + size {
+						blackHole (CPCDay.BackingStorage (gregorianDayNumber: dayNumber));
+					}
+				};
+			},
+			Benchmark ("gregorian.dayFromDayNumber.foundation", sizes: sizes) { size in
+				return Workload (operationsCount: size) {
+					for dayNumber in firstDayNumber ..< firstDayNumber + size {
+						blackHole (CPCDay.BackingStorage (containing: calendar.startDate (ofDayNumber: dayNumber), calendar: calendar));
+					}
+				};
+			},
+			Benchmark ("gregorian.dayNumberFromDay.arithmetic", sizes: sizes) { size in
+				let days = (firstDayNumber ..< firstDayNumber + size).map { guarantee (CPCDay.BackingStorage (gregorianDayNumber: $0)) };
+				return Workload (operationsCount: size) {
+					for day in days {
+						blackHole (day.gregorianDayNumber);
+					}
+				};
+			},
+			Benchmark ("gregorian.dayNumberFromDay.foundation", sizes: sizes) { size in
+				let days = (firstDayNumber ..< firstDayNumber + size).map { guarantee (CPCDay.BackingStorage (gregorianDayNumber: $0)) };
+				return Workload (operationsCount: size) {
+					for day in days {
+						blackHole (calendar.dayNumber (of: day.startDate (using: calendar)));
+					}
+				};
+			},
+		];
+	} ();
+	
+	/// Sorting of shuffled days by ordered keys and by distances between days; sizes are numbers of sorted days.
+	internal static let unitsOrdering: [Benchmark] = {
+		let calendar = Calendar.benchmarkCalendar (.gregorian), sizes = [1_000, 1_000_000];
+		let shuffledDays = { (size: Int) -> [CPCDay] in
+			let firstDay = CPCDay (containing: .benchmarkReferenceDate, calendar: calendar);
+			var randomState = UInt64 (0x9E3779B97F4A7C15);
+			return (0 ..< size).map { _ in
+				randomState = randomState &* 6364136223846793005 &+ 1442695040888963407;
+				return firstDay.advanced (by: Int (randomState >> 33) % (size * 4));
+			};
+		};
+		
+		return [
+			Benchmark ("day.sort.orderedKey", sizes: sizes) { size in
+				let days = shuffledDays (size);
+				return Workload (operationsCount: size) {
+					blackHole (days.sorted ());
+				};
+			},
+			Benchmark ("day.sort.distance", sizes: sizes) { size in
+				let days = shuffledDays (size);
+				return Workload (operationsCount: size) {
+					blackHole (days.sorted { $0.distance (to: $1) > 0 });
+				};
+			},
+		];
+	} ();
+}
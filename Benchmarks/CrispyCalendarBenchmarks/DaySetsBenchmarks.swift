@@ -0,0 +1,71 @@
+//
+//  DaySetsBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Operations of day sets that back unordered selection; sizes are numbers of days in a set.
+	///
+	/// - Note: Bridging of selection to Objective C requires UIKit and is not measured.
+	internal static let daySets: [Benchmark] = {
+		let calendar = Calendar.benchmarkCalendar (.gregorian), sizes = [31, 1024, 65536], threadCounts = [1, 4];
+		let firstDay = CPCDay (containing: .benchmarkReferenceDate, calendar: calendar);
+		let days = { (size: Int, step: Int) in (0 ..< size).map { firstDay.advanced (by: $0 * step) } };
+		
+		return [
+			Benchmark ("daySet.insert", sizes: sizes, threadCounts: threadCounts) { size in
+				let insertedDays = days (size, 1);
+				return Workload (operationsCount: size) {
+					var daySet = CPCDaySet ();
+					for day in insertedDays {
+						daySet.insert (day);
+					}
+					blackHole (daySet);
+				};
+			},
+			Benchmark ("daySet.contains", sizes: sizes, threadCounts: threadCounts) { size in
+				let daySet = CPCDaySet (days (size, 2)), probedDays = days (size, 1);
+				return Workload (operationsCount: size) {
+					for day in probedDays {
+						blackHole (daySet.contains (day));
+					}
+				};
+			},
+			Benchmark ("daySet.union", sizes: sizes, threadCounts: threadCounts) { size in
+				let daySet = CPCDaySet (days (size, 2)), otherDaySet = CPCDaySet (days (size, 3));
+				return Workload (operationsCount: size) {
+					blackHole (daySet.union (otherDaySet));
+				};
+			},
+			Benchmark ("daySet.iterate", sizes: sizes, threadCounts: threadCounts) { size in
+				let daySet = CPCDaySet (days (size, 2));
+				return Workload (operationsCount: size) {
+					for day in daySet {
+						blackHole (day);
+					}
+				};
+			},
+		];
+	} ();
+}
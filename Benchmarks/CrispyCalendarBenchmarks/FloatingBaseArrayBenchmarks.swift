@@ -0,0 +1,100 @@
+//
+//  FloatingBaseArrayBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Growth of floating base arrays at both ends, compared to inserting at front of a contiguous array, trimming to a window
+	/// and the copy that calendar view layout storage makes of its attributes; sizes are numbers of elements.
+	internal static let floatingBaseArrays: [Benchmark] = [
+		Benchmark ("floatingBaseArray.bidirectionalGrowth", sizes: [1024, 65536]) { size in
+			return Workload (operationsCount: size) {
+				var array = FloatingBaseArray <Int> ();
+				for value in 0 ..< size {
+					if (value % 2 == 0) {
+						array.append (value);
+					} else {
+						array.prepend (value);
+					}
+				}
+				blackHole (array);
+			};
+		},
+		Benchmark ("contiguousArray.bidirectionalGrowth", sizes: [1024, 65536]) { size in
+			return Workload (operationsCount: size) {
+				var array = ContiguousArray <Int> ();
+				for value in 0 ..< size {
+					if (value % 2 == 0) {
+						array.append (value);
+					} else {
+						array.insert (value, at: 0);
+					}
+				}
+				blackHole (array);
+			};
+		},
+		Benchmark ("floatingBaseArray.prependRows", sizes: [1024, 65536]) { size in
+			let row = Array (0 ..< 7);
+			return Workload (operationsCount: size) {
+				var array = FloatingBaseArray <Int> ();
+				for _ in 0 ..< size / row.count {
+					array.prepend (contentsOf: row);
+				}
+				blackHole (array);
+			};
+		},
+		Benchmark ("floatingBaseArray.slidingWindow", sizes: [1024, 65536]) { size in
+			let windowSize = 256;
+			return Workload (operationsCount: size) {
+				var array = FloatingBaseArray <Int> ();
+				for value in 0 ..< size {
+					array.append (value);
+					if (array.count > windowSize * 2) {
+						array.trim (to: array.endIndex - windowSize ..< array.endIndex);
+					}
+				}
+				blackHole (array);
+			};
+		},
+		Benchmark ("floatingBaseArray.copyItems", sizes: [1024, 16384]) { size in
+			let array = FloatingBaseArray ((0 ..< size).map { BenchmarkCopyableItem ($0) }, baseOffset: -size / 2);
+			return Workload (operationsCount: size) {
+				blackHole (FloatingBaseArray (array, copyItems: true));
+			};
+		},
+	];
+}
+
+/// Copyable object that stands in for layout attributes that are copied by calendar view layout storage.
+internal final class BenchmarkCopyableItem: NSObject, NSCopying {
+	private let value: Int;
+	
+	internal init (_ value: Int) {
+		self.value = value;
+	}
+	
+	internal func copy (with zone: NSZone? = nil) -> Any {
+		return BenchmarkCopyableItem (self.value);
+	}
+}
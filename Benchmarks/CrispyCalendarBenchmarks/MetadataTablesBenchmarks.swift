@@ -0,0 +1,70 @@
+//
+//  MetadataTablesBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Startup costs of calendars that are not handled arithmetically: generation of a metadata table, mapping of a saved one and
+	/// construction of months around the current one with and without a loaded table; sizes are numbers of years or months.
+	internal static let metadataTables: [Benchmark] = Calendar.benchmarkedIdentifiers.filter { $0 != .gregorian }.flatMap { identifier -> [Benchmark] in
+		let calendar = Calendar.benchmarkCalendar (identifier);
+		let startupMonths = { (size: Int, calendarWrapper: CPCCalendarWrapper) -> Workload in
+			let firstMonth = CPCMonth.current (using: calendarWrapper.calendar).advanced (by: -size / 2);
+			let values = (0 ..< size).map { firstMonth.advanced (by: $0).backingValue };
+			return Workload (operationsCount: size) {
+				for value in values {
+					blackHole (CPCMonth (backedBy: value, calendar: calendarWrapper));
+				}
+			};
+		};
+		
+		return [
+			Benchmark ("metadataTable.generate.\(identifier)", sizes: [1, 21]) { size in
+				return Workload (operationsCount: 1) {
+					blackHole (CPCCalendarMetadataTables.tableData (for: calendar, yearOffsets: -size / 2 ... (size - 1) / 2));
+				};
+			},
+			Benchmark ("metadataTable.map.\(identifier)", sizes: [21]) { size in
+				let directoryURL = FileManager.default.temporaryDirectory.appendingPathComponent ("CrispyCalendarBenchmarks-\(ProcessInfo.processInfo.processIdentifier)", isDirectory: true);
+				let fileURL = guarantee (try? CPCCalendarMetadataTables.writeTable (for: calendar, yearOffsets: -size / 2 ... (size - 1) / 2, to: directoryURL));
+				let calendarWrapper = calendar.wrapped (), currentYear = CPCYear.BackingStorage (containing: Date (), calendar: calendar);
+				return Workload (operationsCount: 1) {
+					let data = guarantee (try? Data (contentsOf: fileURL, options: .alwaysMapped));
+					blackHole (guarantee (CPCCalendarMetadataTable (data, calendar: calendar)).months (of: currentYear, calendar: calendarWrapper));
+				};
+			},
+			Benchmark ("startup.months.table.\(identifier)", sizes: [12, 36]) { size in
+				let tableCalendar = Calendar.benchmarkCalendar (identifier, minimumDaysInFirstWeek: 5), calendarWrapper = tableCalendar.wrapped ();
+				let table = guarantee (CPCCalendarMetadataTable (CPCCalendarMetadataTables.tableData (for: tableCalendar, yearOffsets: -4 ... 4), calendar: tableCalendar));
+				calendarWrapper.metadataTableState.withMutableStoredValue { $0 = .loaded (table) };
+				return startupMonths (size, calendarWrapper);
+			},
+			Benchmark ("startup.months.foundation.\(identifier)", sizes: [12, 36]) { size in
+				let calendarWrapper = Calendar.benchmarkCalendar (identifier, minimumDaysInFirstWeek: 6).wrapped ();
+				calendarWrapper.metadataTableState.withMutableStoredValue { $0 = .generating };
+				return startupMonths (size, calendarWrapper);
+			},
+		];
+	};
+}
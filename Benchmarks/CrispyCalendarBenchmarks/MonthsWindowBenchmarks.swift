@@ -0,0 +1,62 @@
+//
+//  MonthsWindowBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Scripted scrolling of a months window: a fast fling forward, three months per step, followed by scrolling backward,
+	/// two months per step; every step marks an item as displayed, prefetches six months ahead and reads the displayed month.
+	/// Sizes are numbers of scroll steps.
+	///
+	/// Reported memory is an estimate of months that are stored by the window after the last step, divided by number of steps;
+	/// it decreases with size as long as the window stays bounded.
+	internal static let monthsWindow: [Benchmark] = Calendar.benchmarkedIdentifiers.map { identifier in
+		let calendar = Calendar.benchmarkCalendar (identifier), prefetchDistance = 6;
+		return Benchmark ("monthsWindow.scroll.\(identifier)", sizes: [120, 1200]) { size in
+			let turningStep = size * 3 / 4, items = (0 ..< size).map { step -> (item: Int, prefetchedItem: Int) in
+				if (step < turningStep) {
+					return (item: step * 3, prefetchedItem: step * 3 + prefetchDistance);
+				} else {
+					let item = turningStep * 3 - (step - turningStep) * 2;
+					return (item: item, prefetchedItem: item - prefetchDistance);
+				}
+			};
+			let scannedItems = (-CPCMonthsWindow.defaultRetainedMonthsCount * 4) ..< (turningStep * 3 + CPCMonthsWindow.defaultRetainedMonthsCount * 4);
+			let year = CPCYear (containing: .benchmarkReferenceDate, calendar: calendar);
+			var window = CPCMonthsWindow (startingYear: year, referenceItem: 0);
+			
+			return Workload (operationsCount: size, prepare: {
+				window = CPCMonthsWindow (startingYear: year, referenceItem: 0);
+			}, retainedBytes: {
+				return scannedItems.reduce (0) { (window.cachedMonth (at: $1) == nil) ? $0 : $0 + MemoryLayout <CPCMonth>.stride };
+			}) {
+				for (item, prefetchedItem) in items {
+					window.noteDisplayedItem (item);
+					window.fetchMonths (upTo: prefetchedItem, highPriority: false) { _ in };
+					blackHole (window.month (at: item));
+				}
+			};
+		};
+	};
+}
@@ -0,0 +1,88 @@
+//
+//  PrefixSumsBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Row geometry queries of calendar layout: growth by prepending and appending rows, offset to row lookups and heights
+	/// of row ranges, compared to walking row heights one by one; sizes are numbers of rows.
+	internal static let prefixSums: [Benchmark] = {
+		let sizes = [1024, 65536], rowHeights = { (row: Int) -> Double in Double (240 + (row * 7919) % 5 * 40) };
+		let makeSums = { (size: Int) -> FloatingBasePrefixSums <Double> in
+			var result = FloatingBasePrefixSums <Double> (baseOffset: -size / 2);
+			for row in -size / 2 ..< size - size / 2 {
+				result [row] = rowHeights (row);
+			}
+			return result;
+		};
+		let queriedOffsets = { (size: Int) -> [Double] in
+			return (0 ..< 1024).map { Double (($0 * 104729) % size) * 300.0 };
+		};
+		
+		return [
+			Benchmark ("prefixSums.bidirectionalGrowth", sizes: sizes) { size in
+				return Workload (operationsCount: size) {
+					var sums = FloatingBasePrefixSums <Double> ();
+					for row in 0 ..< size / 2 {
+						sums [row] = rowHeights (row);
+						sums [-row - 1] = rowHeights (-row - 1);
+					}
+					blackHole (sums);
+				};
+			},
+			Benchmark ("prefixSums.rowContainingOffset", sizes: sizes) { size in
+				let sums = makeSums (size), offsets = queriedOffsets (size), startIndex = sums.indices.lowerBound;
+				return Workload (operationsCount: offsets.count) {
+					for offset in offsets {
+						blackHole (sums.index (containing: offset, from: startIndex));
+					}
+				};
+			},
+			Benchmark ("prefixSums.rowContainingOffset.linearScan", sizes: sizes) { size in
+				let heights = (-size / 2 ..< size - size / 2).map (rowHeights), offsets = queriedOffsets (size);
+				return Workload (operationsCount: offsets.count) {
+					for offset in offsets {
+						var row = 0, rowOrigin = 0.0;
+						while (row < heights.count) && (rowOrigin + heights [row] <= offset) {
+							rowOrigin += heights [row];
+							row += 1;
+						}
+						blackHole (row);
+					}
+				};
+			},
+			Benchmark ("prefixSums.rowsHeight", sizes: sizes) { size in
+				let sums = makeSums (size), ranges = (0 ..< 1024).map { index -> Range <Int> in
+					let lowerBound = sums.indices.lowerBound + (index * 104729) % size;
+					return lowerBound ..< lowerBound + 8;
+				};
+				return Workload (operationsCount: ranges.count) {
+					for range in ranges {
+						blackHole (sums.sum (of: range));
+					}
+				};
+			},
+		];
+	} ();
+}
@@ -0,0 +1,66 @@
+//
+//  StringTablesBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Strings that are rendered by month views for a whole year: a title and a number of every day of every month,
+	/// taken from the shared string table and formatted by reused date formatters; sizes are numbers of years.
+	internal static let stringTables: [Benchmark] = Calendar.benchmarkedIdentifiers.flatMap { identifier -> [Benchmark] in
+		let calendar = Calendar.benchmarkCalendar (identifier), titleFormat = "LLLL yyyy";
+		let renderedMonths = { (size: Int) -> [(month: CPCMonth, days: [CPCDay])] in
+			let year = CPCYear (containing: .benchmarkReferenceDate, calendar: calendar);
+			return (0 ..< size).flatMap { year.advanced (by: $0) }.map { month in (month: month, days: Array (month.joined ())) };
+		};
+		
+		return [
+			Benchmark ("redraw.year.stringTable.\(identifier)", sizes: [1, 10]) { size in
+				let months = renderedMonths (size);
+				return Workload (operationsCount: months.reduce (0) { $0 + $1.days.count }) {
+					for (month, days) in months {
+						let strings = month.calendarWrapper.stringTable;
+						blackHole (strings.title (of: month, format: titleFormat));
+						for day in days {
+							blackHole (strings.dayNumber (of: day));
+						}
+					}
+				};
+			},
+			Benchmark ("redraw.year.dateFormatter.\(identifier)", sizes: [1, 10]) { size in
+				let months = renderedMonths (size);
+				return Workload (operationsCount: months.reduce (0) { $0 + $1.days.count }) {
+					for (month, days) in months {
+						let titleFormatter = DateFormatter.dequeueFormatter (for: month, format: titleFormat);
+						let dayFormatter = DateFormatter.dequeueFormatter (for: month, dateFormatTemplate: "d");
+						blackHole (titleFormatter.string (from: month.start));
+						for day in days {
+							blackHole (dayFormatter.string (from: day.start));
+						}
+						DateFormatter.makeReusable ([titleFormatter, dayFormatter], wrapper: month.calendarWrapper);
+					}
+				};
+			},
+		];
+	};
+}
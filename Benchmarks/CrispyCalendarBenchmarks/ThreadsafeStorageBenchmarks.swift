@@ -0,0 +1,61 @@
+//
+//  ThreadsafeStorageBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Accesses of a small dictionary that is stored by every kind of threadsafe storage; sizes are numbers of accesses per single write.
+	internal static let threadsafeStorages: [Benchmark] = [
+		Benchmark.threadsafeStorage ("unfair") { UnfairThreadsafeStorage ($0) },
+		Benchmark.threadsafeStorage ("dispatchSemaphore") { DispatchSemaphoreStorage ($0) },
+		Benchmark.threadsafeStorage ("pthreadMutex") { PThreadMutexStorage ($0) },
+		Benchmark.threadsafeStorage ("pthreadRWLock") { PThreadRWLockStorage ($0) },
+		Benchmark.threadsafeStorage ("snapshot") { SnapshotThreadsafeStorage ($0) },
+	];
+	
+	private final class StorageBox <Storage> where Storage: ThreadsafeStorageProtocol {
+		fileprivate var storage: Storage;
+		
+		fileprivate init (_ storage: Storage) {
+			self.storage = storage;
+		}
+	}
+	
+	private static func threadsafeStorage <Storage> (_ mode: String, makeStorage: @escaping ([Int: Int]) -> Storage) -> Benchmark where Storage: ThreadsafeStorageProtocol, Storage.ValueType == [Int: Int] {
+		return Benchmark ("threadsafeStorage.\(mode)", sizes: [1, 16, 1024], threadCounts: [1, 2, 4, 8]) { accessesPerWrite in
+			let keysCount = 64, operationsCount = 4096;
+			let box = StorageBox (makeStorage (Dictionary (uniqueKeysWithValues: (0 ..< keysCount).map { ($0, $0) })));
+			return Workload (operationsCount: operationsCount) {
+				for index in 0 ..< operationsCount {
+					let key = index % keysCount;
+					if (index % accessesPerWrite == 0) {
+						box.storage.withMutableStoredValue { $0 [key] = index };
+					} else {
+						blackHole (box.storage.withStoredValue { $0 [key] });
+					}
+				}
+			};
+		};
+	}
+}
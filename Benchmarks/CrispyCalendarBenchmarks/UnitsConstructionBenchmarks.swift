@@ -0,0 +1,84 @@
+//
+//  UnitsConstructionBenchmarks.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+@testable import CrispyCalendar
+
+/* internal */ extension Benchmark {
+	/// Construction of compound units with interned index shapes, compared to building a per-unit list of week numbers
+	/// with `Calendar.range (of:in:for:)`, as every month did before shapes were interned; sizes are numbers of distinct units.
+	///
+	/// Reported memory is an estimate: inline size of a unit plus its share of index storage, where interned shapes are counted once.
+	/// Non-Gregorian calendars use a metadata table once it is generated in background, so first rounds may take `Foundation` paths.
+	internal static let unitsConstruction: [Benchmark] = Calendar.benchmarkedIdentifiers.flatMap { identifier -> [Benchmark] in
+		let calendar = Calendar.benchmarkCalendar (identifier), calendarWrapper = calendar.wrapped (), sizes = [12, 1200];
+		let monthValues = { (size: Int) -> [CPCMonth.BackingStorage] in
+			let month = CPCMonth (containing: .benchmarkReferenceDate, calendar: calendar);
+			return (0 ..< size).map { month.advanced (by: $0).backingValue };
+		};
+		
+		return [
+			Benchmark ("month.construct.interned.\(identifier)", sizes: sizes) { size in
+				let values = monthValues (size), retainedMonths = BenchmarkRetainedValues <CPCMonth> ();
+				return Workload (operationsCount: size, retainedBytes: {
+					let months = retainedMonths.values, shapes = Dictionary (months.map { (ObjectIdentifier ($0.indicesCache), $0.indicesCache) }, uniquingKeysWith: { first, _ in first });
+					return months.benchmarkAllocatedBytes + shapes.values.reduce (0) { $0 + $1.benchmarkAllocatedBytes };
+				}) {
+					retainedMonths.values = ContiguousArray (values.map { CPCMonth (backedBy: $0, calendar: calendarWrapper) });
+				};
+			},
+			Benchmark ("month.construct.foundationWeekNumbers.\(identifier)", sizes: sizes) { size in
+				let values = monthValues (size), retainedWeekNumbers = BenchmarkRetainedValues <ContiguousArray <Int>> ();
+				return Workload (operationsCount: size, retainedBytes: {
+					let weekNumbers = retainedWeekNumbers.values;
+					return weekNumbers.benchmarkAllocatedBytes + MemoryLayout <CPCMonth>.stride * weekNumbers.count + weekNumbers.reduce (0) { $0 + $1.benchmarkAllocatedBytes };
+				}) {
+					retainedWeekNumbers.values = ContiguousArray (values.map { ContiguousArray (guarantee (calendar.range (of: .weekOfYear, in: .month, for: $0.startDate (using: calendar)))) });
+				};
+			},
+			Benchmark ("week.construct.interned.\(identifier)", sizes: [52, 5200]) { size in
+				let week = CPCWeek (containing: .benchmarkReferenceDate, calendar: calendar), values = (0 ..< size).map { week.advanced (by: $0).backingValue };
+				let retainedWeeks = BenchmarkRetainedValues <CPCWeek> ();
+				return Workload (operationsCount: size, retainedBytes: {
+					let weeks = retainedWeeks.values;
+					return weeks.benchmarkAllocatedBytes + (weeks.first?.indicesCache.benchmarkAllocatedBytes ?? 0);
+				}) {
+					retainedWeeks.values = ContiguousArray (values.map { CPCWeek (backedBy: $0, calendar: calendarWrapper) });
+				};
+			},
+		];
+	};
+}
+
+/// Storage for values produced by a workload, so that their memory may be estimated after measurement.
+internal final class BenchmarkRetainedValues <Value> {
+	internal var values = ContiguousArray <Value> ();
+}
+
+/* internal */ extension CPCCompoundCalendarUnitIndices {
+	/// Approximate heap size of an indices instance: object header and stored properties, component values and ordinals lookup table.
+	internal var benchmarkAllocatedBytes: Int {
+		let componentValues = self.componentValues, ordinalsCount = componentValues.max ().map { $0 - guarantee (componentValues.min ()) + 1 } ?? 0;
+		return 16 + 3 * MemoryLayout <Int>.stride + componentValues.benchmarkAllocatedBytes + 32 + ordinalsCount * MemoryLayout <Int>.stride;
+	}
+}
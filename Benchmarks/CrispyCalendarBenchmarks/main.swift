@@ -0,0 +1,85 @@
+//
+//  main.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// Runs benchmarks of calendar units model and prints results to standard output.
+///
+/// Usage: `CrispyCalendarBenchmarks [--filter <substring>]... [--format json|text] [--min-time <seconds>] [--list]`.
+/// Build with optimizations, e.g. `swift run -c release -Xswiftc -enable-testing CrispyCalendarBenchmarks`.
+
+let benchmarks: [Benchmark] = Benchmark.calendarUnits
+	+ Benchmark.compoundUnits
+	+ Benchmark.unitsConstruction
+	+ Benchmark.metadataTables
+	+ Benchmark.monthsWindow
+	+ Benchmark.floatingBaseArrays
+	+ Benchmark.prefixSums
+	+ Benchmark.stringTables
+	+ Benchmark.gregorianArithmetic
+	+ Benchmark.unitsOrdering
+	+ Benchmark.caches
+	+ Benchmark.cachesComparison
+	+ Benchmark.calendarWrappers
+	+ Benchmark.daySets
+	+ Benchmark.threadsafeStorages;
+
+var filters = [String] (), format = BenchmarkOutputFormat.json, minimumDuration = 0.25, listsBenchmarks = false;
+var arguments = CommandLine.arguments.dropFirst ().makeIterator ();
+while let argument = arguments.next () {
+	switch (argument) {
+	case "--filter":
+		guard let filter = arguments.next () else {
+			fatalError ("[CrispyCalendar] --filter requires a value");
+		}
+		filters.append (filter);
+	case "--format":
+		guard let value = arguments.next (), let parsedFormat = BenchmarkOutputFormat (rawValue: value) else {
+			fatalError ("[CrispyCalendar] --format requires one of: json, text");
+		}
+		format = parsedFormat;
+	case "--min-time":
+		guard let value = arguments.next ().flatMap ({ TimeInterval ($0) }), value > 0.0 else {
+			fatalError ("[CrispyCalendar] --min-time requires a positive number of seconds");
+		}
+		minimumDuration = value;
+	case "--list":
+		listsBenchmarks = true;
+	default:
+		fatalError ("[CrispyCalendar] Unknown argument: \(argument)");
+	}
+}
+
+let selectedBenchmarks = benchmarks.filter { benchmark in filters.isEmpty || filters.contains { benchmark.name.contains ($0) } };
+if (listsBenchmarks) {
+	selectedBenchmarks.forEach { print ($0.name) };
+	exit (0);
+}
+
+setvbuf (stdout, nil, _IOLBF, 0);
+if let header = format.header () {
+	print (header);
+}
+for benchmark in selectedBenchmarks {
+	benchmark.run (minimumDuration: minimumDuration) { print (format.line (for: $0)) };
+}
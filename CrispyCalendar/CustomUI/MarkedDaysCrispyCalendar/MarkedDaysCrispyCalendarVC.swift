@@ -37,7 +37,7 @@ public class MarkedDaysCrispyCalendarVC: CPCCalendarViewController {
 	
 	private let calendar: Calendar
 	private let renderModel: MarkedDaysRenderModel
-	private var markedDays: [CPCDay] 
+	private var markedDays: CPCDayAnnotations<Void>
 	
 	// MARK: - Initialization / Deinitialization
 	
@@ -48,7 +48,7 @@ public class MarkedDaysCrispyCalendarVC: CPCCalendarViewController {
 		calendar: Calendar,
 		dateTapHandleBlock: ((Date) -> Void)? = nil
 	) {
-		self.markedDays = markedDays.map { $0.crispyDay }
+		self.markedDays = CPCDayAnnotations(markedDays.map { (CPCDay(containing: $0, calendar: calendar), ()) })
 		self.renderModel = renderModel
 		self.calendar = calendar
 		self.dateTapHandleBlock = dateTapHandleBlock
@@ -61,7 +61,7 @@ public class MarkedDaysCrispyCalendarVC: CPCCalendarViewController {
 		calendar.firstWeekday = 2 // Monday
 		self.calendar = calendar
 		self.renderModel = MarkedDaysRenderModel.demoModel
-		self.markedDays = []
+		self.markedDays = CPCDayAnnotations()
 		super.init(coder: aDecoder)
 	}
 	
@@ -72,7 +72,13 @@ public class MarkedDaysCrispyCalendarVC: CPCCalendarViewController {
 	}
 	
 	public func setMarkedDays(_ days: [Date]) {
-		markedDays = days.map { $0.crispyDay }
+		let newMarkedDays = CPCDaySet(days.map { CPCDay(containing: $0, calendar: calendar) })
+		let removedDays = markedDays.days.filter { !newMarkedDays.contains($0) }
+		let addedDays = newMarkedDays.filter { !markedDays.contains($0) }
+		var changes: [(CPCDay, Void?)] = removedDays.map { ($0, nil) }
+		changes += addedDays.map { ($0, ()) }
+		let changedMonths = markedDays.update(changes)
+		redrawMonths(changedMonths)
 	}
 
 	public override func viewDidLoad() {
@@ -104,7 +110,7 @@ public class MarkedDaysCrispyCalendarVC: CPCCalendarViewController {
 		calendarView.backgroundColor = UIColor.white
 		calendarView.calendar = calendar
 		calendarView.titleMargins = UIEdgeInsets(top: 16, left: 16, bottom: 8, right: 16)
-		if let minDate = self.markedDays.min() {
+		if let minDate = self.markedDays.days.min() {
 			setSelectedCells(selected: minDate)
 			handleCalendarTap(minDate)
 		}
@@ -135,7 +141,33 @@ public class MarkedDaysCrispyCalendarVC: CPCCalendarViewController {
 	}
 	
 	private func isDayIsMarked(_ day: CPCDay) -> Bool {
-		return markedDays.map({ $0.backingValue }).contains(day.backingValue)
+		return markedDays.contains(day)
+	}
+	
+	private func redrawMonths(_ changedMonths: Set<CPCMonth>) {
+		guard isViewLoaded, !changedMonths.isEmpty else {
+			return
+		}
+		// Marked days are annotated in `calendar`, while the view may have been switched to another one since.
+		let viewCalendar = calendarView.calendar
+		var months = Set<CPCMonth>()
+		for changedMonth in changedMonths {
+			guard changedMonth.calendar != viewCalendar else {
+				months.insert(changedMonth)
+				continue
+			}
+			let lastMonth = CPCMonth(containing: changedMonth.end.addingTimeInterval(-1.0), calendar: viewCalendar)
+			var month = CPCMonth(containing: changedMonth.start, calendar: viewCalendar)
+			while month <= lastMonth {
+				months.insert(month)
+				month = month.next
+			}
+		}
+		calendarView.monthViewsManager.updateManagedMonthViews { monthView in
+			if let month = monthView.month, months.contains(month) {
+				monthView.setNeedsDisplay()
+			}
+		}
 	}
 }
 
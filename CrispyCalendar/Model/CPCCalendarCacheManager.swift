@@ -0,0 +1,204 @@
+//
+//  CPCCalendarCacheManager.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// Controls memory that is used by caches of calendar units and date formatters.
+///
+/// Caches are trimmed on a background queue whenever their total size exceeds the memory budget, regardless
+/// of whether any calendar view is visible or the main run loop is running. System memory pressure notifications
+/// shrink or drop caches immediately.
+///
+/// - Note: Memory usage is estimated rather than measured. Units caches are accounted by capacities of their storage
+///   multiplied by sizes of stored keys and values, without allocator overhead or memory referenced by stored values,
+///   and every reusable date formatter is accounted as a flat 8 KiB, whatever its ICU counterpart actually retains.
+///   The budget should therefore be treated as an approximate target.
+public enum CPCCalendarCaches {
+	/// Maximum number of bytes that all caches should occupy, as estimated by `currentUsage`.
+	public static var memoryBudget: Int {
+		get {
+			return CPCCalendarCacheManager.shared.memoryBudget;
+		}
+		set {
+			CPCCalendarCacheManager.shared.memoryBudget = newValue;
+		}
+	}
+	
+	/// Estimated number of bytes currently occupied by all caches.
+	public static var currentUsage: Int {
+		return CPCCalendarCacheManager.shared.currentUsage;
+	}
+	
+	/// Schedules trimming of caches that exceed the memory budget.
+	public static func purgeIfNeeded () {
+		CPCCalendarCacheManager.shared.setNeedsPurge ();
+	}
+}
+
+/// Keeps track of all calendar wrappers and trims their caches to fit a global memory budget.
+internal final class CPCCalendarCacheManager {
+	private final class WrapperReference {
+		fileprivate weak var wrapper: CPCCalendarWrapper?;
+		
+		fileprivate init (_ wrapper: CPCCalendarWrapper) {
+			self.wrapper = wrapper;
+		}
+	}
+	
+	internal static let shared = CPCCalendarCacheManager ();
+	
+	/// Default memory budget, 4 MiB.
+	private static let defaultMemoryBudget = 4 << 20;
+	/// Fraction of the memory budget that caches are trimmed to once it is exceeded.
+	private static let purgeTargetFactor = 0.75;
+	/// Interval between periodic budget checks.
+	private static let checkInterval = DispatchTimeInterval.seconds (10);
+	private static let checkLeeway = DispatchTimeInterval.seconds (2);
+	
+	internal var memoryBudget: Int {
+		get {
+			return self.storedMemoryBudget.withStoredValue { $0 };
+		}
+		set {
+			self.storedMemoryBudget.withMutableStoredValue { $0 = max (newValue, 0) };
+			self.setNeedsPurge ();
+		}
+	}
+	
+	internal var currentUsage: Int {
+		return self.wrappers.reduce (0) { $0 + $1.cachesByteCount } + DateFormatter.cachedFormattersByteCount;
+	}
+	
+	private var wrappers: [CPCCalendarWrapper] {
+		return self.wrapperReferences.withStoredValue { $0.values.compactMap { $0.wrapper } };
+	}
+	
+	private let queue = DispatchQueue (label: "CrispyCalendar.CPCCalendarCacheManager", qos: .utility);
+	private var storedMemoryBudget = UnfairThreadsafeStorage (CPCCalendarCacheManager.defaultMemoryBudget);
+	private var wrapperReferences = UnfairThreadsafeStorage ([ObjectIdentifier: WrapperReference] ());
+	private var isPurgeScheduled = UnfairThreadsafeStorage (false);
+	private let checkTimer: DispatchSourceTimer;
+#if canImport (Darwin)
+	private let memoryPressureSource: DispatchSourceMemoryPressure;
+#endif
+	
+	private init () {
+		self.checkTimer = DispatchSource.makeTimerSource (queue: self.queue);
+#if canImport (Darwin)
+		self.memoryPressureSource = DispatchSource.makeMemoryPressureSource (eventMask: [.warning, .critical], queue: self.queue);
+#endif
+		
+		self.checkTimer.schedule (deadline: .now () + CPCCalendarCacheManager.checkInterval, repeating: CPCCalendarCacheManager.checkInterval, leeway: CPCCalendarCacheManager.checkLeeway);
+		self.checkTimer.setEventHandler { [unowned self] in
+			self.purgeStep (to: self.purgeTargetUsage, ifExceeding: self.memoryBudget);
+		};
+		self.checkTimer.resume ();
+		
+#if canImport (Darwin)
+		self.memoryPressureSource.setEventHandler { [unowned self] in
+			self.handleMemoryPressure (self.memoryPressureSource.data);
+		};
+		self.memoryPressureSource.resume ();
+#endif
+	}
+	
+	/// Starts tracking caches of a calendar wrapper.
+	///
+	/// - Parameter wrapper: Calendar wrapper to track.
+	internal func register (_ wrapper: CPCCalendarWrapper) {
+		let reference = WrapperReference (wrapper);
+		self.wrapperReferences.withMutableStoredValue {
+			$0 = $0.filter { $0.value.wrapper != nil };
+			$0 [ObjectIdentifier (wrapper)] = reference;
+		};
+	}
+	
+	/// Schedules a budget check on the background queue; repeated calls are coalesced until the check runs.
+	internal func setNeedsPurge () {
+		let shouldSchedule = self.isPurgeScheduled.withMutableStoredValue { isPurgeScheduled -> Bool in
+			defer {
+				isPurgeScheduled = true;
+			}
+			return !isPurgeScheduled;
+		};
+		guard shouldSchedule else {
+			return;
+		}
+		
+		self.queue.async {
+			self.isPurgeScheduled.withMutableStoredValue { $0 = false };
+			self.purgeStep (to: self.purgeTargetUsage, ifExceeding: self.memoryBudget);
+		};
+	}
+	
+	private var purgeTargetUsage: Int {
+		return (Double (self.memoryBudget) * CPCCalendarCacheManager.purgeTargetFactor).integerRounded (.down);
+	}
+	
+	/// Trims caches of the single largest calendar, then reschedules itself until usage reaches the target,
+	/// so that other work submitted to the queue is not blocked by a long purge.
+	///
+	/// - Parameters:
+	///   - targetUsage: Number of bytes that caches should be trimmed to.
+	///   - threshold: Number of bytes that caches may occupy without being trimmed.
+	private func purgeStep (to targetUsage: Int, ifExceeding threshold: Int) {
+		let wrappers = self.wrappers.map { (wrapper: $0, byteCount: $0.cachesByteCount) };
+		let formattersByteCount = DateFormatter.cachedFormattersByteCount;
+		let usage = wrappers.reduce (formattersByteCount) { $0 + $1.byteCount };
+		guard (usage > threshold) else {
+			return;
+		}
+		
+		guard let largest = wrappers.max (by: { $0.byteCount < $1.byteCount }), largest.byteCount > 0 else {
+			return DateFormatter.eraseCachedFormatters ();
+		}
+		
+		let excess = usage - targetUsage;
+		if (excess >= largest.byteCount) && (formattersByteCount > 0) {
+			DateFormatter.eraseCachedFormatters ();
+		}
+		largest.wrapper.purgeCaches (factor: max (0.0, 1.0 - Double (excess) / Double (largest.byteCount)));
+		guard largest.wrapper.cachesByteCount < largest.byteCount else {
+			return;
+		}
+		
+		self.queue.async {
+			self.purgeStep (to: targetUsage, ifExceeding: targetUsage);
+		};
+	}
+	
+#if canImport (Darwin)
+	private func handleMemoryPressure (_ event: DispatchSource.MemoryPressureEvent) {
+		if event.contains (.critical) {
+			DateFormatter.eraseCachedFormatters ();
+			for wrapper in self.wrappers {
+				wrapper.purgeCaches (factor: 0.0);
+				wrapper.invalidateCommonUnitsCaches ();
+			}
+		} else if event.contains (.warning) {
+			let targetUsage = self.purgeTargetUsage / 2;
+			self.purgeStep (to: targetUsage, ifExceeding: targetUsage);
+		}
+	}
+#endif
+}
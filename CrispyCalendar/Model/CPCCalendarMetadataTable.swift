@@ -0,0 +1,472 @@
+//
+//  CPCCalendarMetadataTable.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+#if SWIFT_PACKAGE
+import CrispyCalendarCore
+#endif
+
+/// Generates and stores persistent tables of calendar metadata: month lengths, leap months, first days and week numbers of months.
+///
+/// Metadata of every calendar (distinguished by its identifier, first weekday and minimum number of days in the first week)
+/// is looked up in the main bundle first, then in the caches directory. When no valid table is found, it is generated on
+/// a background queue and saved into the caches directory, so that later launches may memory-map it. Units fall back
+/// to `Foundation` calculations for years that are not covered by a table.
+public enum CPCCalendarMetadataTables {
+	/// Path extension of metadata table files.
+	public static let fileExtension = "cpcmeta";
+	
+	/// Years covered by tables that are generated on first use, relative to the current year.
+	///
+	/// - Note: Changing this value does not affect tables that are already loaded.
+	public static var yearOffsets = -10 ... 10;
+	
+	/// Name of a file containing metadata table of a calendar.
+	///
+	/// - Parameter calendar: Calendar to return metadata table file name for.
+	/// - Returns: Name of a file containing metadata table of the given calendar.
+	public static func fileName (for calendar: Calendar) -> String {
+		return "\(calendar.identifier)-\(calendar.firstWeekday)-\(calendar.minimumDaysInFirstWeek).\(self.fileExtension)";
+	}
+	
+	/// Generates metadata table of a calendar.
+	///
+	/// - Parameters:
+	///   - calendar: Calendar to generate metadata for.
+	///   - yearOffsets: Years to generate metadata for, relative to the current year.
+	/// - Returns: Contents of a metadata table file.
+	public static func tableData (for calendar: Calendar, yearOffsets: ClosedRange <Int>) -> Data {
+		return CPCCalendarMetadataTable.generate (for: calendar, yearOffsets: yearOffsets);
+	}
+	
+	/// Generates metadata table of a calendar and writes it to a directory.
+	///
+	/// Applications may ship generated tables inside their main bundle to skip generation on first launch.
+	/// A table is only used on the operating system version it was generated on, because calendar data may change between versions.
+	///
+	/// - Parameters:
+	///   - calendar: Calendar to generate metadata for.
+	///   - yearOffsets: Years to generate metadata for, relative to the current year.
+	///   - directoryURL: Directory to write metadata table to.
+	/// - Returns: URL of written metadata table file.
+	@discardableResult
+	public static func writeTable (for calendar: Calendar, yearOffsets: ClosedRange <Int>, to directoryURL: URL) throws -> URL {
+		let fileURL = directoryURL.appendingPathComponent (self.fileName (for: calendar));
+		try FileManager.default.createDirectory (at: directoryURL, withIntermediateDirectories: true, attributes: nil);
+		try self.tableData (for: calendar, yearOffsets: yearOffsets).write (to: fileURL, options: .atomic);
+		return fileURL;
+	}
+	
+	fileprivate static var cachesDirectoryURL: URL? {
+		return FileManager.default.urls (for: .cachesDirectory, in: .userDomainMask).first?.appendingPathComponent ("CrispyCalendar", isDirectory: true);
+	}
+}
+
+/// Memory-mapped table of calendar metadata.
+///
+/// Table file layout (all integers are little-endian):
+/// * Header, 80 bytes: magic (`CPCM`, 4 bytes), format version (4 bytes), first weekday (1 byte), minimum days in the first week (1 byte),
+///   padding (2 bytes), years count (4 bytes), months count (4 bytes), calendar identifier (44 bytes, NUL-padded),
+///   major, minor and patch operating system versions (4 bytes each), padding (4 bytes).
+/// * Years, 24 bytes each, sorted by ordered key: ordered key (8 bytes), era (4 bytes), year (4 bytes), first month index (4 bytes), months count (4 bytes).
+/// * Months, 16 bytes each, in chronological order: first day number (4 bytes), year index (2 bytes), month (1 byte), first day (1 byte),
+///   number of days (1 byte), number of weeks (1 byte, zero if week numbers are not stored), week numbers (6 bytes).
+///   Every week is stored as week of year of its first day, so the last week of December may be stored as week 1.
+///
+/// A month that is split by an era change (e.g. January 1989 of the Japanese calendar) is stored as two months of different years,
+/// and the second one starts with a day other than 1.
+internal final class CPCCalendarMetadataTable {
+	/// Metadata of a single month.
+	internal struct Month {
+		/// Era of represented month.
+		internal let era: Int;
+		/// Year of represented month.
+		internal let year: Int;
+		/// Month number of represented month; leap months are encoded by negative numbers.
+		internal let month: Int;
+		/// Day of the first day of represented month; it is greater than 1 only if an era starts in the middle of a month.
+		internal let firstDay: Int;
+		/// Number of days in represented month.
+		internal let numberOfDays: Int;
+		/// Number of the first day of represented month, counted from 1970-01-01.
+		internal let firstDayNumber: Int;
+		/// Week numbers of weeks that contain days of represented month.
+		internal let weekNumbers: ContiguousArray <Int>?;
+		
+		fileprivate let index: Int;
+		
+		/// Day of the last day of represented month.
+		internal var lastDay: Int {
+			return self.firstDay + self.numberOfDays - 1;
+		}
+	}
+	
+	internal enum State {
+		case unloaded;
+		case generating;
+		case loaded (CPCCalendarMetadataTable);
+	}
+	
+	private enum Format {
+		fileprivate static let magic: UInt32 = 0x4D435043;
+		fileprivate static let version: UInt32 = 5;
+		fileprivate static let headerSize = 80;
+		fileprivate static let identifierOffset = 20;
+		fileprivate static let identifierSize = 44;
+		fileprivate static let systemVersionOffset = 64;
+		fileprivate static let systemVersionSize = 16;
+		fileprivate static let yearSize = 24;
+		fileprivate static let monthSize = 16;
+		fileprivate static let maximumWeeksCount = 6;
+	}
+	
+	private let data: Data;
+	private let yearsCount: Int;
+	private let monthsCount: Int;
+	
+	private var monthsOffset: Int {
+		return Format.headerSize + self.yearsCount * Format.yearSize;
+	}
+	
+	/// Validates contents of a metadata table and creates a new table.
+	///
+	/// - Parameters:
+	///   - data: Contents of a metadata table file.
+	///   - calendar: Calendar that the table should describe.
+	internal init? (_ data: Data, calendar: Calendar) {
+		guard data.count >= Format.headerSize,
+			data.cpc_load (UInt32.self, at: 0) == Format.magic,
+			data.cpc_load (UInt32.self, at: 4) == Format.version,
+			Int (data.cpc_load (UInt8.self, at: 8)) == calendar.firstWeekday,
+			Int (data.cpc_load (UInt8.self, at: 9)) == calendar.minimumDaysInFirstWeek,
+			data [Format.identifierOffset ..< Format.identifierOffset + Format.identifierSize] == CPCCalendarMetadataTable.identifierData (of: calendar),
+			data [Format.systemVersionOffset ..< Format.systemVersionOffset + Format.systemVersionSize] == CPCCalendarMetadataTable.systemVersionData else {
+			return nil;
+		}
+		
+		let yearsCount = Int (data.cpc_load (UInt32.self, at: 12)), monthsCount = Int (data.cpc_load (UInt32.self, at: 16));
+		guard data.count == Format.headerSize + yearsCount * Format.yearSize + monthsCount * Format.monthSize,
+			CPCCalendarMetadataTable.hasValidRecords (data, yearsCount: yearsCount, monthsCount: monthsCount) else {
+			return nil;
+		}
+		
+		self.data = data;
+		self.yearsCount = yearsCount;
+		self.monthsCount = monthsCount;
+	}
+	
+	/// Returns numbers of months of a year.
+	///
+	/// - Parameters:
+	///   - year: Year to look up.
+	///   - calendar: Calendar that the table describes.
+	/// - Returns: Month numbers of the given year or `nil` if the year is not covered by this table.
+	internal func months (of year: CPCYear.BackingStorage, calendar: CPCCalendarWrapper) -> ContiguousArray <Int>? {
+		guard let yearIndex = self.yearIndex (of: year.orderedKey (using: calendar)) else {
+			return nil;
+		}
+		
+		let yearOffset = Format.headerSize + yearIndex * Format.yearSize, monthsOffset = self.monthsOffset;
+		let firstMonthIndex = Int (self.data.cpc_load (UInt32.self, at: yearOffset + 16)), monthsCount = Int (self.data.cpc_load (UInt32.self, at: yearOffset + 20));
+		return ContiguousArray ((firstMonthIndex ..< firstMonthIndex + monthsCount).map { Int (self.data.cpc_load (Int8.self, at: monthsOffset + $0 * Format.monthSize + 6)) });
+	}
+	
+	/// Returns metadata of a month.
+	///
+	/// - Parameters:
+	///   - month: Month to look up.
+	///   - calendar: Calendar that the table describes.
+	/// - Returns: Metadata of the given month or `nil` if the month is not covered by this table.
+	internal func month (_ month: CPCMonth.BackingStorage, calendar: CPCCalendarWrapper) -> Month? {
+		guard let yearIndex = self.yearIndex (of: month.containingYear (calendar).orderedKey (using: calendar)) else {
+			return nil;
+		}
+		
+		let yearOffset = Format.headerSize + yearIndex * Format.yearSize, monthsOffset = self.monthsOffset;
+		let firstMonthIndex = Int (self.data.cpc_load (UInt32.self, at: yearOffset + 16)), monthsCount = Int (self.data.cpc_load (UInt32.self, at: yearOffset + 20));
+		for monthIndex in firstMonthIndex ..< firstMonthIndex + monthsCount where Int (self.data.cpc_load (Int8.self, at: monthsOffset + monthIndex * Format.monthSize + 6)) == month.month {
+			return self.month (at: monthIndex);
+		}
+		return nil;
+	}
+	
+	/// Returns metadata of a month that follows another one.
+	///
+	/// - Parameter month: Metadata of a preceding month.
+	/// - Returns: Metadata of the next month or `nil` if it is not covered by this table.
+	internal func month (after month: Month) -> Month? {
+		return self.month (at: month.index + 1);
+	}
+	
+	/// Returns metadata of a month that contains a day.
+	///
+	/// - Parameter dayNumber: Number of a day, counted from 1970-01-01.
+	/// - Returns: Metadata of the month containing the given day or `nil` if it is not covered by this table.
+	internal func month (containingDayNumber dayNumber: Int) -> Month? {
+		let monthsOffset = self.monthsOffset;
+		var lowerBound = 0, upperBound = self.monthsCount;
+		while (lowerBound < upperBound) {
+			let middle = (lowerBound + upperBound) / 2;
+			if (Int (self.data.cpc_load (Int32.self, at: monthsOffset + middle * Format.monthSize)) <= dayNumber) {
+				lowerBound = middle + 1;
+			} else {
+				upperBound = middle;
+			}
+		}
+		
+		guard let month = self.month (at: lowerBound - 1), dayNumber < month.firstDayNumber + month.numberOfDays else {
+			return nil;
+		}
+		return month;
+	}
+	
+	/// Checks that every record of a table references only records that exist, so that lookups never read past the end of the table.
+	///
+	/// - Parameters:
+	///   - data: Contents of a metadata table file with already validated size.
+	///   - yearsCount: Number of year records.
+	///   - monthsCount: Number of month records.
+	/// - Returns: `true` if all year and month records are consistent.
+	private static func hasValidRecords (_ data: Data, yearsCount: Int, monthsCount: Int) -> Bool {
+		var previousKey: UInt64?;
+		for yearIndex in 0 ..< yearsCount {
+			let yearOffset = Format.headerSize + yearIndex * Format.yearSize, key = data.cpc_load (UInt64.self, at: yearOffset);
+			let firstMonthIndex = Int (data.cpc_load (UInt32.self, at: yearOffset + 16)), yearMonthsCount = Int (data.cpc_load (UInt32.self, at: yearOffset + 20));
+			guard (previousKey.map { $0 < key } ?? true), yearMonthsCount > 0, firstMonthIndex + yearMonthsCount <= monthsCount else {
+				return false;
+			}
+			previousKey = key;
+		}
+		
+		let monthsOffset = Format.headerSize + yearsCount * Format.yearSize;
+		var previousFirstDayNumber: Int?;
+		for monthIndex in 0 ..< monthsCount {
+			let offset = monthsOffset + monthIndex * Format.monthSize, firstDayNumber = Int (data.cpc_load (Int32.self, at: offset));
+			guard (previousFirstDayNumber.map { $0 < firstDayNumber } ?? true),
+				Int (data.cpc_load (UInt16.self, at: offset + 4)) < yearsCount,
+				data.cpc_load (UInt8.self, at: offset + 7) > 0,
+				data.cpc_load (UInt8.self, at: offset + 8) > 0,
+				Int (data.cpc_load (UInt8.self, at: offset + 9)) <= Format.maximumWeeksCount else {
+				return false;
+			}
+			previousFirstDayNumber = firstDayNumber;
+		}
+		return true;
+	}
+	
+	private func yearIndex (of orderedKey: UInt64) -> Int? {
+		var lowerBound = 0, upperBound = self.yearsCount;
+		while (lowerBound < upperBound) {
+			let middle = (lowerBound + upperBound) / 2, middleKey = self.data.cpc_load (UInt64.self, at: Format.headerSize + middle * Format.yearSize);
+			if (middleKey < orderedKey) {
+				lowerBound = middle + 1;
+			} else if (middleKey > orderedKey) {
+				upperBound = middle;
+			} else {
+				return middle;
+			}
+		}
+		return nil;
+	}
+	
+	private func month (at index: Int) -> Month? {
+		guard (0 ..< self.monthsCount) ~= index else {
+			return nil;
+		}
+		
+		let offset = self.monthsOffset + index * Format.monthSize;
+		let yearOffset = Format.headerSize + Int (self.data.cpc_load (UInt16.self, at: offset + 4)) * Format.yearSize;
+		let weeksCount = Int (self.data.cpc_load (UInt8.self, at: offset + 9));
+		return Month (
+			era: Int (self.data.cpc_load (Int32.self, at: yearOffset + 8)),
+			year: Int (self.data.cpc_load (Int32.self, at: yearOffset + 12)),
+			month: Int (self.data.cpc_load (Int8.self, at: offset + 6)),
+			firstDay: Int (self.data.cpc_load (UInt8.self, at: offset + 7)),
+			numberOfDays: Int (self.data.cpc_load (UInt8.self, at: offset + 8)),
+			firstDayNumber: Int (self.data.cpc_load (Int32.self, at: offset)),
+			weekNumbers: (weeksCount > 0) ? ContiguousArray ((0 ..< weeksCount).map { Int (self.data.cpc_load (UInt8.self, at: offset + 10 + $0)) }) : nil,
+			index: index
+		);
+	}
+}
+
+/* fileprivate */ extension CPCCalendarMetadataTable {
+	fileprivate static func identifierData (of calendar: Calendar) -> Data {
+		var result = Data ("\(calendar.identifier)".utf8.prefix (Format.identifierSize));
+		result.append (Data (count: Format.identifierSize - result.count));
+		return result;
+	}
+	
+	/// Version of the running operating system, which determines calendar data (ICU) that the table was generated from.
+	fileprivate static var systemVersionData: Data {
+		let systemVersion = ProcessInfo.processInfo.operatingSystemVersion;
+		var result = Data (capacity: Format.systemVersionSize);
+		result.cpc_append (UInt32 (truncatingIfNeeded: systemVersion.majorVersion));
+		result.cpc_append (UInt32 (truncatingIfNeeded: systemVersion.minorVersion));
+		result.cpc_append (UInt32 (truncatingIfNeeded: systemVersion.patchVersion));
+		result.cpc_append (UInt32 (0));
+		return result;
+	}
+	
+	fileprivate static func generate (for calendar: Calendar, yearOffsets: ClosedRange <Int>) -> Data {
+		let calendarWrapper = calendar.wrapped ();
+		let currentYearStart = guarantee (calendar.dateInterval (of: .year, for: Date ())).start;
+		let endDate = guarantee (calendar.date (byAdding: .year, value: yearOffsets.upperBound + 1, to: currentYearStart));
+		var years = [(key: UInt64, era: Int, year: Int, firstMonthIndex: Int, monthsCount: Int)] (), months = Data ();
+		
+		var monthStart = guarantee (calendar.date (byAdding: .year, value: yearOffsets.lowerBound, to: currentYearStart)), monthsCount = 0;
+		while (monthStart < endDate) {
+			let firstDay = CPCDay.BackingStorage (containing: monthStart, calendar: calendar), year = firstDay.containingYear (calendarWrapper);
+			if let lastYear = years.last, (lastYear.era == year.era) && (lastYear.year == year.year) {
+				years [years.count - 1].monthsCount += 1;
+			} else {
+				years.append ((key: year.orderedKey (using: calendarWrapper), era: year.era, year: year.year, firstMonthIndex: monthsCount, monthsCount: 1));
+			}
+			
+			let numberOfDays = CPCDayBackingStorageIterator.lastDayOfMonth (containing: firstDay, calendar: calendar) - firstDay.day + 1, firstDayNumber = calendar.dayNumber (of: monthStart);
+			let weekNumbers = CPCMonth.weekNumbers (firstDayNumber: firstDayNumber, lastDayNumber: firstDayNumber + numberOfDays - 1, using: calendarWrapper);
+			let storesWeekNumbers = (weekNumbers.count <= Format.maximumWeeksCount) && weekNumbers.allSatisfy { (0 ... Int (UInt8.max)) ~= $0 };
+			months.cpc_append (Int32 (firstDayNumber));
+			months.cpc_append (UInt16 (years.count - 1));
+			months.cpc_append (Int8 (firstDay.month));
+			months.cpc_append (UInt8 (firstDay.day));
+			months.cpc_append (UInt8 (numberOfDays));
+			months.cpc_append (UInt8 (storesWeekNumbers ? weekNumbers.count : 0));
+			for weekIndex in 0 ..< Format.maximumWeeksCount {
+				months.cpc_append ((storesWeekNumbers && (weekIndex < weekNumbers.count)) ? UInt8 (weekNumbers [weekIndex]) : 0);
+			}
+			
+			monthsCount += 1;
+			monthStart = guarantee (calendar.date (byAdding: .day, value: numberOfDays, to: monthStart));
+		}
+		
+		var result = Data (capacity: Format.headerSize + years.count * Format.yearSize + months.count);
+		result.cpc_append (Format.magic);
+		result.cpc_append (Format.version);
+		result.cpc_append (UInt8 (calendar.firstWeekday));
+		result.cpc_append (UInt8 (calendar.minimumDaysInFirstWeek));
+		result.cpc_append (UInt16 (0));
+		result.cpc_append (UInt32 (years.count));
+		result.cpc_append (UInt32 (months.count / Format.monthSize));
+		result.append (self.identifierData (of: calendar));
+		result.append (self.systemVersionData);
+		for year in years.sorted (by: { $0.key < $1.key }) {
+			result.cpc_append (year.key);
+			result.cpc_append (Int32 (year.era));
+			result.cpc_append (Int32 (year.year));
+			result.cpc_append (UInt32 (year.firstMonthIndex));
+			result.cpc_append (UInt32 (year.monthsCount));
+		}
+		result.append (months);
+		return result;
+	}
+	
+	fileprivate static func load (for calendar: Calendar) -> CPCCalendarMetadataTable? {
+		let fileName = CPCCalendarMetadataTables.fileName (for: calendar);
+		let candidateURLs = [
+			Bundle.main.url (forResource: fileName, withExtension: nil),
+			CPCCalendarMetadataTables.cachesDirectoryURL?.appendingPathComponent (fileName),
+		];
+		
+		let calendarWrapper = calendar.wrapped (), currentYear = CPCYear.BackingStorage (containing: Date (), calendar: calendar);
+		for case .some (let fileURL) in candidateURLs {
+			guard let data = try? Data (contentsOf: fileURL, options: .alwaysMapped), let table = CPCCalendarMetadataTable (data, calendar: calendar), table.months (of: currentYear, calendar: calendarWrapper) != nil else {
+				continue;
+			}
+			return table;
+		}
+		return nil;
+	}
+}
+
+/* internal */ extension CPCCalendarWrapper {
+	/// Metadata table of the wrapped calendar, if one is available.
+	///
+	/// The first access maps a previously saved table; if there is no valid table, it is generated and saved in background
+	/// and this property returns `nil` until generation finishes. Gregorian calendars are handled arithmetically and have no table.
+	/// A loaded table is published once and is read without locking afterwards; it is never replaced.
+	internal var metadataTable: CPCCalendarMetadataTable? {
+		guard !self.isGregorian else {
+			return nil;
+		}
+		if let publishedTable = __CPCAtomicPointerLoad (self.publishedMetadataTable) {
+			return Unmanaged <CPCCalendarMetadataTable>.fromOpaque (publishedTable).takeUnretainedValue ();
+		}
+		
+		let state = self.metadataTableState.withMutableStoredValue { state -> CPCCalendarMetadataTable.State in
+			guard case .unloaded = state else {
+				return state;
+			}
+			state = .generating;
+			return .unloaded;
+		};
+		
+		switch (state) {
+		case .loaded (let table):
+			return self.publishMetadataTable (table);
+		case .generating:
+			return nil;
+		case .unloaded:
+			break;
+		}
+		
+		let calendar = self.calendar;
+		if let table = CPCCalendarMetadataTable.load (for: calendar) {
+			self.metadataTableState.withMutableStoredValue { $0 = .loaded (table) };
+			return self.publishMetadataTable (table);
+		}
+		
+		DispatchQueue.global (qos: .utility).async { [weak self] in
+			let data = CPCCalendarMetadataTable.generate (for: calendar, yearOffsets: CPCCalendarMetadataTables.yearOffsets);
+			if let directoryURL = CPCCalendarMetadataTables.cachesDirectoryURL {
+				try? FileManager.default.createDirectory (at: directoryURL, withIntermediateDirectories: true, attributes: nil);
+				try? data.write (to: directoryURL.appendingPathComponent (CPCCalendarMetadataTables.fileName (for: calendar)), options: .atomic);
+			}
+			guard let table = CPCCalendarMetadataTable (data, calendar: calendar) else {
+				return;
+			}
+			self?.metadataTableState.withMutableStoredValue { $0 = .loaded (table) };
+		};
+		return nil;
+	}
+	
+	private func publishMetadataTable (_ table: CPCCalendarMetadataTable) -> CPCCalendarMetadataTable {
+		let retainedTable = Unmanaged.passRetained (table);
+		guard __CPCAtomicPointerPublish (self.publishedMetadataTable, retainedTable.toOpaque ()) else {
+			retainedTable.release ();
+			return Unmanaged <CPCCalendarMetadataTable>.fromOpaque (guarantee (__CPCAtomicPointerLoad (self.publishedMetadataTable))).takeUnretainedValue ();
+		}
+		return table;
+	}
+}
+
+/* fileprivate */ extension Data {
+	fileprivate func cpc_load <T> (_ type: T.Type, at offset: Int) -> T where T: FixedWidthInteger {
+		return self.withUnsafeBytes { T (littleEndian: $0.load (fromByteOffset: offset, as: T.self)) };
+	}
+	
+	fileprivate mutating func cpc_append <T> (_ value: T) where T: FixedWidthInteger {
+		var value = value.littleEndian;
+		Swift.withUnsafeBytes (of: &value) { self.append (contentsOf: $0) };
+	}
+}
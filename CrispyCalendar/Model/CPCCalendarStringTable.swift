@@ -0,0 +1,177 @@
+//
+//  CPCCalendarStringTable.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// Localized strings that are used to render calendar units of a single calendar and locale.
+///
+/// Day numbers and unit symbols are formatted once when the table is created; month titles are formatted
+/// on first request and interned afterwards. Tables are shared by all users of a calendar wrapper.
+///
+/// Interned month titles are bounded: half of them are dropped whenever their number reaches a limit, and they are
+/// trimmed together with units caches of the calendar when caches exceed the memory budget.
+internal final class CPCCalendarStringTable {
+	private struct MonthTitleKey: Hashable {
+		private let month: CPCMonth.BackingStorage;
+		private let format: String;
+		
+		fileprivate init (_ month: CPCMonth.BackingStorage, _ format: String) {
+			self.month = month;
+			self.format = format;
+		}
+	}
+	
+	/// Symbol arrays that are formatted in advance.
+	private static let symbolKeyPaths: [KeyPath <Calendar, [String]>] = [
+		\.weekdaySymbols, \.shortWeekdaySymbols, \.veryShortWeekdaySymbols,
+		\.standaloneWeekdaySymbols, \.shortStandaloneWeekdaySymbols, \.veryShortStandaloneWeekdaySymbols,
+		\.monthSymbols, \.shortMonthSymbols, \.veryShortMonthSymbols,
+		\.standaloneMonthSymbols, \.shortStandaloneMonthSymbols, \.veryShortStandaloneMonthSymbols,
+	];
+	/// Maximum number of months that are inspected to find all possible day numbers.
+	private static let dayNumbersSearchMonthsLimit = 48;
+	/// Maximum number of interned month titles.
+	private static let monthTitlesLimit = 1024;
+	
+	private unowned let calendar: CPCCalendarWrapper;
+	/// Formatted numbers of days, starting with 1.
+	private let dayNumbers: [String];
+	private let symbols: [KeyPath <Calendar, [String]>: [String]];
+	private var monthTitles = UnfairThreadsafeStorage ([MonthTitleKey: String] ());
+	
+	/// Estimated number of bytes occupied by interned month titles.
+	internal var monthTitlesByteCount: Int {
+		return self.monthTitles.withStoredValue {
+			$0.capacity * (MemoryLayout <MonthTitleKey>.stride + MemoryLayout <String>.stride) + $0.values.reduce (0) { $0 + $1.utf8.count };
+		};
+	}
+	
+	/// Creates string table for the given calendar.
+	///
+	/// - Parameter calendar: Calendar and locale that are used to format strings.
+	internal init (calendar: CPCCalendarWrapper) {
+		self.calendar = calendar;
+		self.dayNumbers = CPCCalendarStringTable.makeDayNumbers (calendar: calendar);
+		
+		let wrappedCalendar = calendar.calendar;
+		var symbols = [KeyPath <Calendar, [String]>: [String]] (minimumCapacity: CPCCalendarStringTable.symbolKeyPaths.count);
+		for keyPath in CPCCalendarStringTable.symbolKeyPaths {
+			symbols [keyPath] = wrappedCalendar [keyPath: keyPath];
+		}
+		self.symbols = symbols;
+	}
+	
+	/// Returns localized number of the given day in its month.
+	internal func dayNumber (of day: CPCDay) -> String {
+		let dayNumber = day.backingValue.day;
+		if (1 ... self.dayNumbers.count) ~= dayNumber {
+			return self.dayNumbers [dayNumber - 1];
+		}
+		
+		let formatter = DateFormatter.dequeueFormatter (for: day.containingMonth, dateFormatTemplate: "d");
+		defer { formatter.makeReusable (wrapper: self.calendar) };
+		return formatter.string (from: day.start);
+	}
+	
+	/// Returns localized symbols that are stored by a `Calendar` at the given key path.
+	internal func symbols (_ keyPath: KeyPath <Calendar, [String]>) -> [String] {
+		return self.symbols [keyPath] ?? self.calendar.calendar [keyPath: keyPath];
+	}
+	
+	/// Returns title of the month that is rendered using the given date format.
+	internal func title (of month: CPCMonth, format: String) -> String {
+		let key = MonthTitleKey (month.backingValue, format);
+		if let title = self.monthTitles.withStoredValue ({ $0 [key] }) {
+			return title;
+		}
+		
+		let formatter = DateFormatter.dequeueFormatter (for: month, format: format);
+		defer { formatter.makeReusable (wrapper: self.calendar) };
+		let title = formatter.string (from: month.start);
+		self.monthTitles.withMutableStoredValue {
+			if ($0.count >= CPCCalendarStringTable.monthTitlesLimit) {
+				CPCCalendarStringTable.removeMonthTitles (from: &$0, keepingCount: $0.count / 2);
+			}
+			$0 [key] = title;
+		};
+		return title;
+	}
+	
+	/// Drops interned month titles.
+	///
+	/// - Parameter factor: Fraction of titles that should be kept.
+	internal func purgeMonthTitles (factor: Double) {
+		self.monthTitles.withMutableStoredValue {
+			CPCCalendarStringTable.removeMonthTitles (from: &$0, keepingCount: (Double ($0.count) * factor).integerRounded (.down));
+		};
+	}
+	
+	private static func removeMonthTitles (from monthTitles: inout [MonthTitleKey: String], keepingCount count: Int) {
+		if (count <= 0) {
+			monthTitles.removeAll ();
+		} else if (count < monthTitles.count) {
+			monthTitles = Dictionary (uniqueKeysWithValues: monthTitles.prefix (count).lazy.map { ($0.key, $0.value) });
+		}
+	}
+	
+	private static func makeDayNumbers (calendar: CPCCalendarWrapper) -> [String] {
+		let maximumDay = (calendar.calendar.maximumRange (of: .day)?.upperBound ?? 32) - 1;
+		var dayNumbers = [String?] (repeating: nil, count: maximumDay), missingCount = maximumDay;
+		var month = CPCMonth (containing: Date (), calendar: calendar);
+		let formatter = DateFormatter.dequeueFormatter (for: month, dateFormatTemplate: "d");
+		defer { formatter.makeReusable (wrapper: calendar) };
+		
+		var days = ContiguousArray <CPCDay.BackingStorage> ();
+		for _ in 0 ..< CPCCalendarStringTable.dayNumbersSearchMonthsLimit {
+			days.removeAll (keepingCapacity: true);
+			month.appendDayBackingValues (to: &days);
+			for day in days where dayNumbers.indices ~= day.day - 1 && dayNumbers [day.day - 1] == nil {
+				dayNumbers [day.day - 1] = formatter.string (from: CPCDay (backedBy: day, calendar: calendar).start);
+				missingCount -= 1;
+			}
+			if (missingCount == 0) {
+				break;
+			}
+			month = month.next;
+		}
+		return dayNumbers.prefix { $0 != nil }.map { $0! };
+	}
+}
+
+/* internal */ extension CPCCalendarWrapper {
+	/// Localized strings of the wrapped calendar.
+	internal var stringTable: CPCCalendarStringTable {
+		if let stringTable = self.stringTableStorage.withStoredValue ({ $0 }) {
+			return stringTable;
+		}
+		
+		let stringTable = CPCCalendarStringTable (calendar: self);
+		return self.stringTableStorage.withMutableStoredValue {
+			if let existingTable = $0 {
+				return existingTable;
+			}
+			$0 = stringTable;
+			return stringTable;
+		};
+	}
+}
@@ -165,18 +165,25 @@ extension CPCCalendarUnit {
 	
 	@inlinable
 	public var start: Date {
-		return self.backingValue.startDate (using: self.calendar);
+		return self.backingValue.calendarStartDate (using: self.calendarWrapper);
 	}
 	
 	@inlinable
 	public var end: Date {
-		return guarantee (self.calendar.date (byAdding: Self.representedUnit, value: 1, to: self.start));
+		return self.backingValue.calendarEndDate (using: self.calendarWrapper);
 	}
 	
 	public static func == (lhs: Self, rhs: Self) -> Bool {
 		return (lhs.calendarWrapper === rhs.calendarWrapper) && (lhs.backingValue == rhs.backingValue);
 	}
 	
+	public static func < (lhs: Self, rhs: Self) -> Bool {
+		guard lhs.calendarWrapper === rhs.calendarWrapper else {
+			return lhs.distance (to: rhs) > 0;
+		}
+		return lhs.backingValue.orderedKey (using: lhs.calendarWrapper) < rhs.backingValue.orderedKey (using: rhs.calendarWrapper);
+	}
+	
 #if swift(>=4.2)
 	public func hash (into hasher: inout Hasher) {
 		hasher.combine (self.calendarWrapper);
@@ -190,7 +197,7 @@ extension CPCCalendarUnit {
 	
 	@usableFromInline
 	internal init (containing date: Date, calendar: CalendarWrapper) {
-		self.init (backedBy: BackingType (containing: date, calendar: calendar.calendar), calendar: calendar);
+		self.init (backedBy: BackingType (containing: date, calendar: calendar), calendar: calendar);
 	}
 
 	public init (containing date: Date, calendarOf otherUnit: CPCDay) {
@@ -218,8 +225,7 @@ extension CPCCalendarUnit {
 			return cachedResult;
 		}
 		
-		let calendar = self;
-		let result = self.backingValue.distance (to: other.backingValue, using: calendar.calendar);
+		let result = self.backingValue.distance (to: other.backingValue, using: self.calendarWrapper);
 		self.cacheDistance (result, to: other);
 		return result;
 	}
@@ -229,7 +235,7 @@ extension CPCCalendarUnit {
 			return cachedResult;
 		}
 		
-		let result = Self (backedBy: self.backingValue.advanced (by: n, using: self.calendar), calendar: self.calendarWrapper);
+		let result = Self (backedBy: self.backingValue.advanced (by: n, using: self.calendarWrapper), calendar: self.calendarWrapper);
 		self.cacheUnitValue (result, advancedBy: n);
 		return result;
 	}
@@ -276,10 +282,14 @@ extension CPCCalendarUnit {
 		}
 	}
 	
-	private static var calendarUnitIntervalFormatters = UnfairThreadsafeStorage ([CacheKey: DateIntervalFormatter] ());
+	private static var calendarUnitIntervalFormatters = SnapshotThreadsafeStorage ([CacheKey: DateIntervalFormatter] ());
 	
 	fileprivate static func calendarUnitIntervalFormatter <Unit> (for unitType: Unit.Type, calendar: CPCCalendarWrapper) -> DateIntervalFormatter where Unit: CPCCalendarUnit {
 		let key = CacheKey (for: unitType, calendar: calendar);
+		if let storedValue = self.calendarUnitIntervalFormatters.withStoredValue ({ $0 [key] }) {
+			return storedValue;
+		}
+		
 		return self.calendarUnitIntervalFormatters.withMutableStoredValue {
 			if let storedValue = $0 [key] {
 				return storedValue;
@@ -295,14 +305,42 @@ extension CPCCalendarUnit {
 
 /* internal */ extension Locale {
 	internal static var currentUsed: Locale {
-		return Bundle.main.preferredLocalizations.first.map (Locale.init) ?? .current;
+		return CPCCurrentCalendarCache.shared.wrapper.calendar.locale ?? .current;
 	}
 }
 
 /* internal */ extension Calendar {
 	internal static var currentUsed: Calendar {
-		var result = Calendar.current;
-		result.locale = .currentUsed;
-		return result;
+		return CPCCurrentCalendarCache.shared.wrapper.calendar;
+	}
+}
+
+/// Keeps wrapper of the current calendar, localized to the preferred localization of the main bundle, until system locale or time zone changes.
+internal final class CPCCurrentCalendarCache {
+	internal static let shared = CPCCurrentCalendarCache ();
+	
+	internal var wrapper: CPCCalendarWrapper {
+		return self.storage.withMutableStoredValue {
+			if let wrapper = $0 {
+				return wrapper;
+			}
+			
+			var calendar = Calendar.current;
+			calendar.locale = Bundle.main.preferredLocalizations.first.map (Locale.init) ?? .current;
+			let wrapper = calendar.wrapped ();
+			$0 = wrapper;
+			return wrapper;
+		};
+	}
+	
+	private var storage = UnfairThreadsafeStorage (CPCCalendarWrapper?.none);
+	private var observers = [NSObjectProtocol] ();
+	
+	private init () {
+		self.observers = [NSLocale.currentLocaleDidChangeNotification, .NSSystemTimeZoneDidChange].map {
+			NotificationCenter.default.addObserver (forName: $0, object: nil, queue: nil) { [unowned self] _ in
+				self.storage.withMutableStoredValue { $0 = nil };
+			};
+		};
 	}
 }
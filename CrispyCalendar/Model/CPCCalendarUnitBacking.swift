@@ -22,6 +22,9 @@
 //
 
 import Foundation
+#if SWIFT_PACKAGE
+import CrispyCalendarCore
+#endif
 
 /* internal */ extension CPCDay {
 	@usableFromInline
@@ -61,6 +64,23 @@ extension CPCDay.BackingStorage: RawValueConvertible, ExpressibleByDateComponent
 		return result;
 	}
 	
+	internal func orderedKey (using calendar: CPCCalendarWrapper) -> UInt64 {
+		return self.orderedKey (descendingFirstEraYears: calendar.hasDescendingFirstEraYears);
+	}
+	
+	/// Creates a new storage from a key that was returned by `orderedKey (using:)`.
+	///
+	/// - Parameters:
+	///   - key: Ordered key of a day.
+	///   - calendar: Wrapped calendar that was used to create the key.
+	internal init (orderedKey key: UInt64, using calendar: CPCCalendarWrapper) {
+		let monthBits = Int ((key >> 8) & 0xFF);
+		let era = Int ((key >> 44) & 0xFFFFF) - (1 << 19), year = Int ((key >> 16) & 0xFFFFFFF) - (1 << 27);
+		let month = ((monthBits & 1) != 0) ? (1 - monthBits) / 2 : monthBits / 2, day = Int (key & 0xFF) - (1 << 7);
+		let isDescendingYear = calendar.hasDescendingFirstEraYears && (era == 0);
+		self.init (era: era, year: isDescendingYear ? -year : year, month: month, day: day);
+	}
+	
 	internal func containingYear (_ calendar: CPCCalendarWrapper) -> CPCYear.BackingStorage {
 #if !arch(x86_64) && !arch(arm64)
 		return CPCYear.BackingStorage (containing: self, layout: CPCYear.BackingStorage.Layout (for: calendar));
@@ -133,6 +153,10 @@ extension CPCMonth.BackingStorage: RawValueConvertible, ExpressibleByDateCompone
 		return result;
 	}
 	
+	internal func orderedKey (using calendar: CPCCalendarWrapper) -> UInt64 {
+		return self.orderedKey (descendingFirstEraYears: calendar.hasDescendingFirstEraYears);
+	}
+	
 	internal func containingYear (_ calendar: CPCCalendarWrapper) -> CPCYear.BackingStorage {
 		return CPCYear.BackingStorage (containing: self);
 	}
@@ -191,6 +215,10 @@ extension CPCYear.BackingStorage: RawValueConvertible, ExpressibleByDateComponen
 	internal func dateComponents (_ calendar: Calendar) -> DateComponents {
 		return DateComponents (calendar: calendar, era: self.era, year: self.year);
 	}
+	
+	internal func orderedKey (using calendar: CPCCalendarWrapper) -> UInt64 {
+		return self.orderedKey (descendingFirstEraYears: calendar.hasDescendingFirstEraYears);
+	}
 }
 
 extension CPCYear.BackingStorage: CustomStringConvertible, CustomDebugStringConvertible, CustomReflectable {
@@ -27,6 +27,8 @@ import Foundation
 internal protocol CPCCalendarUnitBackingType: Hashable {
 	/// Type for which this one serves as a backing storage.
 	associatedtype BackedType where BackedType: CPCCalendarUnit;
+	/// Type of cheaply comparable keys that preserve chronological order of backing values.
+	associatedtype OrderedKey where OrderedKey: Comparable;
 
 	/// Creates a new storage for a calendar unit that contains a specific date.
 	///
@@ -54,6 +56,31 @@ internal protocol CPCCalendarUnitBackingType: Hashable {
 	///   - calendar: Calendar to perform calculations with.
 	/// - Returns: Instance of backing value for which represented unit's `start` date is advanced by `value` unit durations.
 	func advanced (by value: Int, using calendar: Calendar) -> Self;
+	
+	/// Calculate distance between this value and other one, measured in the unit's durations.
+	///
+	/// Backing types may override this method to provide faster implementations for specific calendars.
+	///
+	/// - Parameters:
+	///   - other: An instance of backing value to calculate distance to.
+	///   - calendar: Wrapped calendar to perform calculations with.
+	/// - Returns: Number of represented calendar units between starts of corresponding date intervals.
+	func distance (to other: Self, using calendar: CPCCalendarWrapper) -> Int;
+	/// Calculate a backing value with specific distance from represented one.
+	///
+	/// Backing types may override this method to provide faster implementations for specific calendars.
+	///
+	/// - Parameters:
+	///   - value: Distance from this value.
+	///   - calendar: Wrapped calendar to perform calculations with.
+	/// - Returns: Instance of backing value for which represented unit's `start` date is advanced by `value` unit durations.
+	func advanced (by value: Int, using calendar: CPCCalendarWrapper) -> Self;
+	
+	/// Get a key which may be used to compare this value with other ones of the same calendar.
+	///
+	/// - Parameter calendar: Wrapped calendar of the represented unit.
+	/// - Returns: Key which is less than keys of all later units and greater than keys of all earlier ones.
+	func orderedKey (using calendar: CPCCalendarWrapper) -> OrderedKey;
 }
 
 /// Expresses that a type can be initialized using `DateComponents`.
@@ -76,6 +103,62 @@ internal protocol DateComponentsConvertible {
 	func dateComponents (_ calendar: Calendar) -> DateComponents;
 }
 
+extension CPCCalendarUnitBackingType {
+	internal func distance (to other: Self, using calendar: CPCCalendarWrapper) -> Int {
+		return self.calendarDistance (to: other, using: calendar);
+	}
+	
+	internal func advanced (by value: Int, using calendar: CPCCalendarWrapper) -> Self {
+		return self.calendarAdvanced (by: value, using: calendar);
+	}
+	
+	/// Creates a new storage for a calendar unit that contains a specific date, counting the calculation as a `Calendar` call.
+	///
+	/// - Parameters:
+	///   - date: The date that should be contained in the backed calendar unit.
+	///   - calendar: Wrapped calendar to perform calculations with.
+	internal init (containing date: Date, calendar: CPCCalendarWrapper) {
+		self = CPCInstrumentation.measure (.calendarCall, calendar: calendar) { Self (containing: date, calendar: calendar.calendar) };
+	}
+	
+	/// Calculate distance between this value and other one using `Calendar`, counting the calculation as a `Calendar` call.
+	///
+	/// - Parameters:
+	///   - other: An instance of backing value to calculate distance to.
+	///   - calendar: Wrapped calendar to perform calculations with.
+	/// - Returns: Number of represented calendar units between starts of corresponding date intervals.
+	internal func calendarDistance (to other: Self, using calendar: CPCCalendarWrapper) -> Int {
+		return CPCInstrumentation.measure (.calendarCall, calendar: calendar) { self.distance (to: other, using: calendar.calendar) };
+	}
+	
+	/// Calculate a backing value with specific distance from represented one using `Calendar`, counting the calculation as a `Calendar` call.
+	///
+	/// - Parameters:
+	///   - value: Distance from this value.
+	///   - calendar: Wrapped calendar to perform calculations with.
+	/// - Returns: Instance of backing value for which represented unit's `start` date is advanced by `value` unit durations.
+	internal func calendarAdvanced (by value: Int, using calendar: CPCCalendarWrapper) -> Self {
+		return CPCInstrumentation.measure (.calendarCall, calendar: calendar) { self.advanced (by: value, using: calendar.calendar) };
+	}
+	
+	/// Get an earliest date that is contained in a backed calendar unit, counting the calculation as a `Calendar` call.
+	///
+	/// - Parameter calendar: Wrapped calendar to perform calculations with.
+	/// - Returns: Earliest date of the represented calendar unit.
+	internal func calendarStartDate (using calendar: CPCCalendarWrapper) -> Date {
+		return CPCInstrumentation.measure (.calendarCall, calendar: calendar) { self.startDate (using: calendar.calendar) };
+	}
+	
+	/// Get a date that follows the latest date of a backed calendar unit, counting the calculations as `Calendar` calls.
+	///
+	/// - Parameter calendar: Wrapped calendar to perform calculations with.
+	/// - Returns: Start date of the next calendar unit.
+	internal func calendarEndDate (using calendar: CPCCalendarWrapper) -> Date {
+		let startDate = self.calendarStartDate (using: calendar);
+		return CPCInstrumentation.measure (.calendarCall, calendar: calendar) { guarantee (calendar.calendar.date (byAdding: BackedType.representedUnit, value: 1, to: startDate)) };
+	}
+}
+
 extension CPCCalendarUnitBackingType where Self: ExpressibleByDateComponents {
 	internal init (containing date: Date, calendar: Calendar) {
 		self.init (calendar.dateComponents (Self.requiredComponents, from: date));
@@ -22,6 +22,9 @@
 //
 
 import Foundation
+#if SWIFT_PACKAGE
+import CrispyCalendarCore
+#endif
 
 // MARK: - Caching interface
 
@@ -45,7 +48,7 @@ internal enum CPCCommonCalendarUnitCacheKey: CaseIterable {
 	/// - Parameter other: Calendar unit to fetch distance to.
 	/// - Returns: Distance from this unit to `other` or nil if no such value was previously cached.
 	internal func cachedDistance (to other: Self) -> Stride? {
-		return self.calendarWrapper.unitSpecificCacheInstance ().calendarUnit (self, distanceTo: other);
+		return CPCInstrumentation.recordCacheLookup (self.calendarWrapper.unitSpecificCacheInstance ().calendarUnit (self, distanceTo: other), calendar: self.calendarWrapper);
 	}
 	
 	/// Cache a distance between two calendar units.
@@ -61,7 +64,7 @@ internal enum CPCCommonCalendarUnitCacheKey: CaseIterable {
 	/// - Parameter stride: Required distance between units.
 	/// - Returns: Unit that has requested distance from this one or nil if no such value was previously cached.
 	internal func cachedAdvancedUnit (by stride: Self.Stride) -> Self? {
-		return self.calendarWrapper.unitSpecificCacheInstance ().calendarUnit (self, advancedBy: stride);
+		return CPCInstrumentation.recordCacheLookup (self.calendarWrapper.unitSpecificCacheInstance ().calendarUnit (self, advancedBy: stride), calendar: self.calendarWrapper);
 	}
 	
 	/// Cache a calendar unit that has specific distance from this one.
@@ -86,7 +89,7 @@ internal enum CPCCommonCalendarUnitCacheKey: CaseIterable {
 	/// - Parameter index: Index of queried subunit.
 	/// - Returns: Subunit at `index`ths place of this unit or nil if no such value was previously cached.
 	internal func cachedElement (at index: Index) -> Element? {
-		return self.calendarWrapper.unitSpecificCacheInstance ().calendarUnit (self, elementAt: index);
+		return CPCInstrumentation.recordCacheLookup (self.calendarWrapper.unitSpecificCacheInstance ().calendarUnit (self, elementAt: index), calendar: self.calendarWrapper);
 	}
 	
 	/// Cache a calendar subunit for specified position in this unit.
@@ -102,7 +105,7 @@ internal enum CPCCommonCalendarUnitCacheKey: CaseIterable {
 	/// - Parameter element: Subunit, index of which is requested.
 	/// - Returns: Index of given subunit or nil if no such value was previously cached.
 	internal func cachedIndex (of element: Element) -> Index? {
-		return self.calendarWrapper.unitSpecificCacheInstance ().calendarUnit (self, indexOf: element);
+		return CPCInstrumentation.recordCacheLookup (self.calendarWrapper.unitSpecificCacheInstance ().calendarUnit (self, indexOf: element), calendar: self.calendarWrapper);
 	}
 	
 	/// Cache position of a subunit inside this one.
@@ -116,23 +119,30 @@ internal enum CPCCommonCalendarUnitCacheKey: CaseIterable {
 
 // MARK: - Caching implementation declarations
 
+/// Usage counters of a single cache shard.
+internal struct CPCCalendarUnitCacheStatistics {
+	/// Number of lookups that found a cached value.
+	internal var hits = 0;
+	/// Number of lookups that did not find a cached value.
+	internal var misses = 0;
+	/// Number of values that were evicted to free space for new ones or during purge.
+	internal var evictions = 0;
+}
+
 internal protocol CPCCalendarUnitSpecificCacheProtocol {
 	var count: Int { get };
+	var byteCount: Int { get };
+	var shardsStatistics: [CPCCalendarUnitCacheStatistics] { get };
 	
-	mutating func purge (factor: Double);
+	func purge (factor: Double);
 }
 
 internal protocol CPCCalendarCommonUnitValuesCacheProtocol {
 	typealias CommonCacheKey = CPCCommonCalendarUnitCacheKey;
 	
-	mutating func invalidate ();
-}
-
-private protocol CPCUnusedItemsPurgingCacheProtocol {
-	associatedtype KeyType where KeyType: Hashable;
-	associatedtype ValueType;
+	var byteCount: Int { get };
 	
-	subscript (key: KeyType) -> ValueType? { mutating get set };
+	mutating func invalidate ();
 }
 
 // MARK: - Cache implementation
@@ -142,65 +152,240 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 	internal typealias CommonUnitValuesCacheProtocol = CPCCalendarCommonUnitValuesCacheProtocol;
 	
 	fileprivate class UnitSpecificCacheBase <Unit>: UnitSpecificCacheProtocol where Unit: CPCCalendarUnit {
-		private final class UnusedItemsPurgingCache <Key, Value>: CPCUnusedItemsPurgingCacheProtocol where Key: Hashable {
-			fileprivate typealias KeyType = Key;
-			fileprivate typealias ValueType = Value;
+		/// Fixed-capacity cache that evicts values using CLOCK (second chance) algorithm.
+		///
+		/// Lookups never mutate the cache itself: they only mark a slot as recently used and update statistics
+		/// using relaxed atomic operations, so they may run concurrently under a shared lock. Insertions and
+		/// evictions take amortized constant time and require exclusive access.
+		private struct ClockEvictingCache <Key, Value> where Key: Hashable {
+			private struct Slot {
+				fileprivate let key: Key;
+				fileprivate var value: Value;
+			}
 			
-			private struct ValueWrapper {
-				fileprivate let value: Value;
-				fileprivate let usageCount: Int;
+			/// Slots reference bits and lookup counters that are updated by concurrent readers.
+			///
+			/// Reference bits storage grows together with slots, so that an empty cache does not hold memory for its full capacity.
+			private final class SharedState {
+				fileprivate let lookupCounters: UnsafeMutablePointer <Int64>;
+				fileprivate private (set) var referenceBitsCapacity = 0;
+				private var referenceBits: UnsafeMutablePointer <UInt8>;
+				
+				fileprivate var byteCount: Int {
+					return self.referenceBitsCapacity * MemoryLayout <UInt8>.stride + 2 * MemoryLayout <Int64>.stride;
+				}
+				
+				fileprivate var hits: Int {
+					return Int (__CPCAtomicCounterLoad (self.lookupCounters));
+				}
+				
+				fileprivate var misses: Int {
+					return Int (__CPCAtomicCounterLoad (self.lookupCounters + 1));
+				}
+				
+				fileprivate init () {
+					self.referenceBits = .allocate (capacity: 0);
+					self.lookupCounters = .allocate (capacity: 2);
+					self.lookupCounters.initialize (repeating: 0, count: 2);
+				}
+				
+				deinit {
+					self.referenceBits.deallocate ();
+					self.lookupCounters.deallocate ();
+				}
+				
+				/// Reallocates reference bits storage; requires exclusive access to the cache.
+				///
+				/// - Parameters:
+				///   - capacity: New number of stored reference bits.
+				///   - count: Number of leading reference bits to preserve.
+				fileprivate func resizeReferenceBits (capacity: Int, preservingCount count: Int) {
+					let referenceBits = UnsafeMutablePointer <UInt8>.allocate (capacity: capacity);
+					referenceBits.initialize (from: self.referenceBits, count: count);
+					(referenceBits + count).initialize (repeating: 0, count: capacity - count);
+					self.referenceBits.deallocate ();
+					self.referenceBits = referenceBits;
+					self.referenceBitsCapacity = capacity;
+				}
+				
+				fileprivate func recordHit (slotIndex: Int) {
+					__CPCAtomicCounterAdd (self.lookupCounters, 1);
+					if (!__CPCAtomicFlagLoad (self.referenceBits + slotIndex)) {
+						__CPCAtomicFlagStore (self.referenceBits + slotIndex, true);
+					}
+				}
+				
+				fileprivate func recordMiss () {
+					__CPCAtomicCounterAdd (self.lookupCounters + 1, 1);
+				}
+				
+				fileprivate func isReferenced (slotIndex: Int) -> Bool {
+					return __CPCAtomicFlagLoad (self.referenceBits + slotIndex);
+				}
+				
+				fileprivate func setReferenced (_ isReferenced: Bool, slotIndex: Int) {
+					__CPCAtomicFlagStore (self.referenceBits + slotIndex, isReferenced);
+				}
 			}
 			
 			fileprivate var count: Int {
-				return self.values.count;
+				return self.slotIndices.count;
 			}
 			
-			private var values: [Key: ValueWrapper] = {
-				var result = [Key: ValueWrapper] ();
-				result.reserveCapacity (CPCCalendarWrapper.cacheSizeThreshold);
-				return result;
-			} ();
+			/// Estimated number of bytes allocated for slots and keys storage: capacities multiplied by element sizes,
+			/// without hash table metadata and allocator overhead.
+			fileprivate var byteCount: Int {
+				return self.slots.capacity * MemoryLayout <Slot?>.stride
+					+ self.slotIndices.capacity * (MemoryLayout <Key>.stride + MemoryLayout <Int>.stride)
+					+ self.freeSlotIndices.capacity * MemoryLayout <Int>.stride
+					+ self.sharedState.byteCount;
+			}
 			
-			fileprivate init () {}
+			fileprivate var statistics: CPCCalendarUnitCacheStatistics {
+				return CPCCalendarUnitCacheStatistics (hits: self.sharedState.hits, misses: self.sharedState.misses, evictions: self.evictionsCount);
+			}
+			
+			private let capacity: Int;
+			private let sharedState: SharedState;
+			private var slots: ContiguousArray <Slot?>;
+			private var slotIndices: [Key: Int];
+			private var freeSlotIndices = ContiguousArray <Int> ();
+			private var hand = 0;
+			private var evictionsCount = 0;
+			
+			fileprivate init (capacity: Int) {
+				self.capacity = max (capacity, 1);
+				self.sharedState = SharedState ();
+				self.slots = ContiguousArray ();
+				self.slotIndices = [:];
+			}
 			
 			fileprivate subscript (key: Key) -> Value? {
 				get {
-					guard let value = self.values [key] else {
+					guard let slotIndex = self.slotIndices [key], let slot = self.slots [slotIndex] else {
+						self.sharedState.recordMiss ();
 						return nil;
 					}
 					
-					self.values [key] = ValueWrapper (value: value.value, usageCount: value.usageCount + 1);
-					return value.value;
+					self.sharedState.recordHit (slotIndex: slotIndex);
+					return slot.value;
 				}
 				set {
 					if let newValue = newValue {
-						self.values [key] = ValueWrapper (value: newValue, usageCount: 0);
+						self.insert (newValue, for: key);
 					} else {
-						self.values [key] = nil;
+						self.removeValue (for: key);
 					}
 				}
 			}
 			
-			fileprivate func purge (factor: Double) {
-				guard let maxUsageCount = self.values.max (by: { $0.value.usageCount < $1.value.usageCount })?.value.usageCount else {
+			fileprivate mutating func purge (factor: Double) {
+				let targetCount = (Double (self.count) * factor).integerRounded (.down);
+				while (self.count > targetCount) {
+					self.freeSlotIndices.append (self.evictNextSlot ());
+				}
+				self.compact ();
+			}
+			
+			/// Moves values from the tail of slots storage into free slots that precede it and truncates the storage,
+			/// releasing memory of evicted slots.
+			///
+			/// Only keys of moved values are updated. Keys storage is rebuilt only when it became at least four times larger
+			/// than needed, so that moderate purges do not rehash every stored key.
+			private mutating func compact () {
+				let count = self.count, previousSlotsCount = self.slots.count;
+				guard count < previousSlotsCount else {
+					self.freeSlotIndices = [];
 					return;
 				}
 				
-				let threshold = (Double (maxUsageCount) * factor).integerRounded (.down);
-				let filteredValues = self.values.filter { $0.value.usageCount >= threshold };
-				self.values.removeAll (keepingCapacity: true);
-				for (key, value) in filteredValues {
-					self.values [key] = value;
+				var freeSlotIndex = 0;
+				for slotIndex in count ..< previousSlotsCount {
+					guard let slot = self.slots [slotIndex] else {
+						continue;
+					}
+					while (self.slots [freeSlotIndex] != nil) {
+						freeSlotIndex += 1;
+					}
+					
+					// Slots only move towards the beginning, so reference bits may be moved in place.
+					self.sharedState.setReferenced (self.sharedState.isReferenced (slotIndex: slotIndex), slotIndex: freeSlotIndex);
+					self.slots [freeSlotIndex] = slot;
+					self.slotIndices [slot.key] = freeSlotIndex;
+				}
+				for slotIndex in count ..< previousSlotsCount {
+					self.sharedState.setReferenced (false, slotIndex: slotIndex);
 				}
+				
+				self.slots = ContiguousArray (self.slots [..<count]);
+				self.sharedState.resizeReferenceBits (capacity: count, preservingCount: count);
+				if (self.slotIndices.capacity >= 4 * max (count, 1)) {
+					self.slotIndices = Dictionary (uniqueKeysWithValues: self.slotIndices.lazy.map { ($0.key, $0.value) });
+				}
+				self.freeSlotIndices = [];
+				self.hand = 0;
 			}
-		}
-		
-		fileprivate struct ThreadsafePurgingCacheStorage <KeyComplement, Value>: CPCCalendarUnitSpecificCacheProtocol, CPCUnusedItemsPurgingCacheProtocol
-			where KeyComplement: Hashable {
 			
-			fileprivate typealias KeyType = Key;
-			fileprivate typealias ValueType = Value;
+			private mutating func insert (_ value: Value, for key: Key) {
+				if let slotIndex = self.slotIndices [key] {
+					self.slots [slotIndex] = Slot (key: key, value: value);
+					self.sharedState.setReferenced (true, slotIndex: slotIndex);
+					return;
+				}
+				
+				let slot = Slot (key: key, value: value);
+				let slotIndex: Int;
+				if let freeSlotIndex = self.freeSlotIndices.popLast () {
+					slotIndex = freeSlotIndex;
+					self.slots [slotIndex] = slot;
+				} else if (self.slots.count < self.capacity) {
+					slotIndex = self.slots.endIndex;
+					if (slotIndex == self.sharedState.referenceBitsCapacity) {
+						self.sharedState.resizeReferenceBits (capacity: min (max (2 * slotIndex, 16), self.capacity), preservingCount: slotIndex);
+					}
+					self.slots.append (slot);
+				} else {
+					slotIndex = self.evictNextSlot ();
+					self.slots [slotIndex] = slot;
+				}
+				self.slotIndices [key] = slotIndex;
+				self.sharedState.setReferenced (false, slotIndex: slotIndex);
+			}
 			
+			private mutating func removeValue (for key: Key) {
+				guard let slotIndex = self.slotIndices.removeValue (forKey: key) else {
+					return;
+				}
+				self.slots [slotIndex] = nil;
+				self.freeSlotIndices.append (slotIndex);
+			}
+			
+			/// Advances clock hand until a slot that was not used since previous sweep is found and evicts its value.
+			///
+			/// - Returns: Index of the slot that was freed.
+			private mutating func evictNextSlot () -> Int {
+				while true {
+					let slotIndex = self.hand;
+					self.hand = (slotIndex + 1) % self.slots.count;
+					
+					guard let slot = self.slots [slotIndex] else {
+						continue;
+					}
+					guard !self.sharedState.isReferenced (slotIndex: slotIndex) else {
+						self.sharedState.setReferenced (false, slotIndex: slotIndex);
+						continue;
+					}
+					
+					self.slots [slotIndex] = nil;
+					self.slotIndices [slot.key] = nil;
+					self.evictionsCount += 1;
+					return slotIndex;
+				}
+			}
+		}
+		
+		/// Cache storage that splits stored values into a number of independently locked shards by key hash.
+		fileprivate struct ThreadsafePurgingCacheStorage <KeyComplement, Value>: CPCCalendarUnitSpecificCacheProtocol where KeyComplement: Hashable {
 			fileprivate struct Key: Hashable {
 				private let unit: Unit;
 				private let complementValue: KeyComplement;
@@ -211,19 +396,63 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 				}
 			}
 			
+			private final class Shard {
+				private var storage: PThreadRWLockStorage <ClockEvictingCache <Key, Value>>;
+				
+				fileprivate var count: Int {
+					return self.storage.withStoredValue { $0.count };
+				}
+				
+				fileprivate var byteCount: Int {
+					return self.storage.withStoredValue { $0.byteCount };
+				}
+				
+				fileprivate var statistics: CPCCalendarUnitCacheStatistics {
+					return self.storage.withStoredValue { $0.statistics };
+				}
+				
+				fileprivate init (capacity: Int) {
+					self.storage = PThreadRWLockStorage (ClockEvictingCache (capacity: capacity));
+				}
+				
+				fileprivate subscript (key: Key) -> Value? {
+					get { return self.storage.withStoredValue { $0 [key] } }
+					set { self.storage.withMutableStoredValue { $0 [key] = newValue } }
+				}
+				
+				fileprivate func purge (factor: Double) {
+					self.storage.withMutableStoredValue { $0.purge (factor: factor) };
+				}
+			}
+			
 			fileprivate var count: Int {
-				return self.storage.withStoredValue { $0.count };
+				return self.shards.reduce (0) { $0 + $1.count };
+			}
+			
+			fileprivate var byteCount: Int {
+				return self.shards.reduce (0) { $0 + $1.byteCount };
+			}
+			
+			fileprivate var shardsStatistics: [CPCCalendarUnitCacheStatistics] {
+				return self.shards.map { $0.statistics };
 			}
 			
-			private var storage = UnfairThreadsafeStorage (UnusedItemsPurgingCache <Key, Value> ());
+			private let shards: ContiguousArray <Shard> = {
+				let shardsCount = CPCCalendarWrapper.cacheShardsCount, shardCapacity = CPCCalendarWrapper.cacheSizeThreshold / shardsCount;
+				return ContiguousArray ((0 ..< shardsCount).map { _ in Shard (capacity: shardCapacity) });
+			} ();
 			
 			fileprivate subscript (key: Key) -> Value? {
-				get { return self.storage.withStoredValue { $0 [key] } }
-				set { self.storage.withMutableStoredValue { $0 [key] = newValue } }
+				get { return self.shard (for: key) [key] }
+				nonmutating set { self.shard (for: key) [key] = newValue }
 			}
 			
-			fileprivate mutating func purge (factor: Double) {
-				self.storage.withMutableStoredValue { $0.purge (factor: factor) };
+			fileprivate func purge (factor: Double) {
+				self.shards.forEach { $0.purge (factor: factor) };
+			}
+			
+			private func shard (for key: Key) -> Shard {
+				return self.shards [key.hashValue & (self.shards.count - 1)];
 			}
 		}
 		
@@ -233,6 +462,18 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 			return result;
 		}
 		
+		fileprivate var byteCount: Int {
+			var result = 0;
+			self.enumerateSubcaches { (subcache: CPCCalendarUnitSpecificCacheProtocol) in result += subcache.byteCount };
+			return result;
+		}
+		
+		fileprivate var shardsStatistics: [CPCCalendarUnitCacheStatistics] {
+			var result = [CPCCalendarUnitCacheStatistics] ();
+			self.enumerateSubcaches { (subcache: CPCCalendarUnitSpecificCacheProtocol) in result += subcache.shardsStatistics };
+			return result;
+		}
+		
 		private unowned let calendarWrapper: CPCCalendarWrapper;
 		
 		fileprivate required init (_ calendarWrapper: CPCCalendarWrapper) {
@@ -240,18 +481,12 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 		}
 		
 		fileprivate func purge (factor: Double) {
-			self.enumerateSubcaches { (subcache: inout CPCCalendarUnitSpecificCacheProtocol) in
+			self.enumerateSubcaches { (subcache: CPCCalendarUnitSpecificCacheProtocol) in
 				subcache.purge (factor: factor);
 			};
 		}
 		
-		fileprivate func enumerateSubcaches (using block: (CPCCalendarUnitSpecificCacheProtocol) -> ()) -> () {
-			self.enumerateSubcaches { (subcache: inout CPCCalendarUnitSpecificCacheProtocol) in
-				block (subcache);
-			};
-		}
-		
-		fileprivate func enumerateSubcaches (using block: (inout CPCCalendarUnitSpecificCacheProtocol) -> ()) -> () {}
+		fileprivate func enumerateSubcaches (using block: (CPCCalendarUnitSpecificCacheProtocol) -> ()) -> () {}
 	}
 	
 	fileprivate class UnitSpecificCache <Unit>: UnitSpecificCacheBase <Unit> where Unit: CPCCalendarUnit {
@@ -287,14 +522,6 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 			block (self.advancedUnitsCache);
 			block (self.distancesCache);
 		}
-		
-		fileprivate override func enumerateSubcaches (using block: (inout CPCCalendarUnitSpecificCacheProtocol) -> ()) -> () {
-			super.enumerateSubcaches (using: block);
-			
-			var currentCache: CPCCalendarUnitSpecificCacheProtocol;
-			currentCache = self.distancesCache; block (&currentCache); self.distancesCache = currentCache as! UnitDistancesStorage;
-			currentCache = self.advancedUnitsCache; block (&currentCache); self.advancedUnitsCache = currentCache as! UnitAdvancesStorage;
-		}
 	}
 	
 	fileprivate final class CompoundUnitSpecificCache <Unit>: UnitSpecificCache <Unit> where Unit: CPCCompoundCalendarUnit {
@@ -328,14 +555,6 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 			block (self.smallerUnitValuesCache);
 			block (self.smallerUnitIndexesCache);
 		}
-		
-		fileprivate override func enumerateSubcaches (using block: (inout CPCCalendarUnitSpecificCacheProtocol) -> ()) -> () {
-			super.enumerateSubcaches (using: block);
-			
-			var currentCache: CPCCalendarUnitSpecificCacheProtocol;
-			currentCache = self.smallerUnitValuesCache; block (&currentCache); self.smallerUnitValuesCache = currentCache as! UnitValuesStorage;
-			currentCache = self.smallerUnitIndexesCache; block (&currentCache); self.smallerUnitIndexesCache = currentCache as! UnitIndexesStorage;
-		}
 	}
 	
 	fileprivate final class CommonUnitsCache <Unit>: CommonUnitValuesCacheProtocol where Unit: CPCCalendarUnit {
@@ -344,6 +563,10 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 		private let currentDateChangesObserver: NSObjectProtocol;
 		private unowned let calendar: CPCCalendarWrapper;
 		
+		fileprivate var byteCount: Int {
+			return self.storage.withStoredValue { $0.capacity * (MemoryLayout <CommonCacheKey>.stride + MemoryLayout <Unit>.stride) };
+		}
+		
 		fileprivate subscript (key: CommonCacheKey) -> Unit {
 			return self.storage.withMutableStoredValue { storage in
 				if storage.isEmpty {
@@ -370,21 +593,37 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 		}
 	}
 
+	/// Maximum number of values stored by a single unit-specific cache.
 	private static let cacheSizeThreshold = 20480;
-	private static let cachePurgeFactor = 0.5;
+	private static let cacheShardsCount = 8;
+	
+	/// Estimated number of bytes allocated by unit-specific and common units caches and interned month titles of this calendar.
+	internal var cachesByteCount: Int {
+		let unitSpecificCachesByteCount = self.unitSpecificCaches.withStoredValue { $0.values.reduce (0) { $0 + $1.byteCount } };
+		let commonUnitCachesByteCount = self.commonUnitCaches.withStoredValue { $0.values.reduce (0) { $0 + $1.byteCount } };
+		let monthTitlesByteCount = self.stringTableStorage.withStoredValue { $0 }?.monthTitlesByteCount ?? 0;
+		return unitSpecificCachesByteCount + commonUnitCachesByteCount + monthTitlesByteCount;
+	}
 	
-	private var currentCacheSize: Int {
-		return self.unitSpecificCaches.withStoredValue { $0.values.reduce (0) { $0 + $1.count } };
+	/// Usage counters of every shard of every unit-specific cache of this calendar.
+	internal var unitSpecificCachesStatistics: [CPCCalendarUnitCacheStatistics] {
+		return self.unitSpecificCaches.withStoredValue { $0.values.flatMap { $0.shardsStatistics } };
 	}
 
-	internal func purgeCacheIfNeeded () {
-		if (self.currentCacheSize > CPCCalendarWrapper.cacheSizeThreshold) {
-			self.unitSpecificCaches.withMutableStoredValue {
-				for key in $0.keys {
-					$0 [key]?.purge (factor: CPCCalendarWrapper.cachePurgeFactor);
-				}
-			};
-		}
+	/// Evicts least recently used values from unit-specific caches of this calendar, along with interned month titles.
+	///
+	/// Caches are purged one shard at a time without holding the caches registry lock, so lookups of other shards
+	/// and creation of caches for other unit types proceed meanwhile.
+	///
+	/// - Parameter factor: Fraction of values that should be kept in every cache.
+	internal func purgeCaches (factor: Double) {
+		CPCInstrumentation.measure (.cachePurge, calendar: self) {
+			let caches = self.unitSpecificCaches.withStoredValue { Array ($0.values) };
+			for cache in caches {
+				cache.purge (factor: factor);
+			}
+			self.stringTableStorage.withStoredValue { $0 }?.purgeMonthTitles (factor: factor);
+		};
 	}
 	
 	internal func invalidateCommonUnitsCaches () {
@@ -400,8 +639,12 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 	}
 	
 	fileprivate func unitSpecificCommonCache <Unit> () -> CommonUnitsCache <Unit> {
+		let typeID = ObjectIdentifier (Unit.self);
+		if let existingCache = self.commonUnitCaches.withStoredValue ({ $0 [typeID] as? CommonUnitsCache <Unit> }) {
+			return existingCache;
+		}
+		
 		return self.commonUnitCaches.withMutableStoredValue { [unowned self] caches in
-			let typeID = ObjectIdentifier (Unit.self);
 			if let existingCache = caches [typeID] as? CommonUnitsCache <Unit> {
 				return existingCache;
 			}
@@ -423,8 +666,12 @@ private protocol CPCUnusedItemsPurgingCacheProtocol {
 	}
 	
 	private func unitSpecificCacheInstanceImpl <Unit, Cache> () -> Cache where Cache: UnitSpecificCacheBase <Unit> {
+		let typeID = ObjectIdentifier (Unit.self);
+		if let existingCache = self.unitSpecificCaches.withStoredValue ({ $0 [typeID] as? Cache }) {
+			return existingCache;
+		}
+		
 		return self.unitSpecificCaches.withMutableStoredValue { caches in
-			let typeID = ObjectIdentifier (Unit.self);
 			if let existingCache = caches [typeID] as? Cache {
 				return existingCache;
 			}
@@ -0,0 +1,136 @@
+//
+//  CPCCalendarUnitDayNumbers.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/* internal */ extension Calendar {
+	/// Number of 2001-01-01 (the reference date) counted from 1970-01-01.
+	private static let referenceDateDayNumber = 11323;
+	private static let secondsPerDay = 86400.0;
+	
+	/// Calculates number of the day that contains given date, counted from 1970-01-01 in this calendar's time zone.
+	///
+	/// - Parameter date: Date to perform calculation for.
+	internal func dayNumber (of date: Date) -> Int {
+		let localTimestamp = date.timeIntervalSinceReferenceDate + Double (self.timeZone.secondsFromGMT (for: date));
+		return Int ((localTimestamp / Calendar.secondsPerDay).rounded (.down)) + Calendar.referenceDateDayNumber;
+	}
+	
+	/// Calculates start date of a day with given number.
+	///
+	/// - Parameter dayNumber: Number of a day, counted from 1970-01-01 in this calendar's time zone.
+	internal func startDate (ofDayNumber dayNumber: Int) -> Date {
+		let utcNoon = Date (timeIntervalSinceReferenceDate: (Double (dayNumber - Calendar.referenceDateDayNumber) + 0.5) * Calendar.secondsPerDay);
+		return self.startOfDay (for: utcNoon.addingTimeInterval (-Double (self.timeZone.secondsFromGMT (for: utcNoon))));
+	}
+}
+
+/* internal */ extension CPCDay.BackingStorage {
+	/// Calculates number of represented day, counted from 1970-01-01.
+	///
+	/// - Parameter calendar: Calendar to perform calculations with.
+	internal func dayNumber (using calendar: CPCCalendarWrapper) -> Int {
+		if calendar.isGregorian, let result = self.gregorianDayNumber {
+			return result;
+		}
+		if let month = calendar.metadataTable?.month (self.containingMonth (calendar), calendar: calendar) {
+			return month.firstDayNumber + self.day - month.firstDay;
+		}
+		
+		return calendar.calendar.dayNumber (of: self.calendarStartDate (using: calendar));
+	}
+}
+
+/* internal */ extension CPCCalendarWrapper {
+	/// Number of days in every week.
+	internal static let daysPerWeek = 7;
+	
+	/// Calculates day of week for a day with given number.
+	///
+	/// - Parameter dayNumber: Number of a day, counted from 1970-01-01.
+	/// - Returns: Day of week, where 1 is Sunday and 7 is Saturday.
+	internal static func weekday (ofDayNumber dayNumber: Int) -> Int {
+		let daysSinceSunday = (dayNumber + 4) % CPCCalendarWrapper.daysPerWeek; // 1970-01-01 was Thursday
+		return ((daysSinceSunday < 0) ? daysSinceSunday + CPCCalendarWrapper.daysPerWeek : daysSinceSunday) + 1;
+	}
+	
+	/// Calculates number of the first day of a week that contains given day.
+	///
+	/// - Parameters:
+	///   - dayNumber: Number of a day, counted from 1970-01-01.
+	///   - firstWeekday: First day of week for the calendar.
+	internal static func firstDayNumberOfWeek (containingDayNumber dayNumber: Int, firstWeekday: Int) -> Int {
+		let daysPerWeek = CPCCalendarWrapper.daysPerWeek;
+		return dayNumber - (CPCCalendarWrapper.weekday (ofDayNumber: dayNumber) - firstWeekday + daysPerWeek) % daysPerWeek;
+	}
+	
+	/// Calculates number of the first day of a week that contains given day.
+	///
+	/// - Parameter dayNumber: Number of a day, counted from 1970-01-01.
+	internal func firstDayNumberOfWeek (containingDayNumber dayNumber: Int) -> Int {
+		return CPCCalendarWrapper.firstDayNumberOfWeek (containingDayNumber: dayNumber, firstWeekday: self.firstWeekday);
+	}
+	
+	/// Calculates week number in the year for a day with given number.
+	///
+	/// - Parameter dayNumber: Number of a day, counted from 1970-01-01.
+	internal func weekOfYear (ofDayNumber dayNumber: Int) -> Int {
+		if self.isGregorian, let result = self.gregorianWeekOfYear (ofDayNumber: dayNumber) {
+			return result;
+		}
+		
+		return CPCInstrumentation.measure (.calendarCall, calendar: self) {
+			let calendar = self.calendar;
+			return calendar.component (.weekOfYear, from: calendar.startDate (ofDayNumber: dayNumber));
+		};
+	}
+	
+	private func gregorianWeekOfYear (ofDayNumber dayNumber: Int) -> Int? {
+		let prolepticYear = CPCGregorianArithmetic.date (dayNumber: dayNumber).prolepticYear;
+		guard let firstWeekStart = self.gregorianFirstWeekStart (prolepticYear: prolepticYear) else {
+			return nil;
+		}
+		
+		if (dayNumber < firstWeekStart) {
+			return self.gregorianFirstWeekStart (prolepticYear: prolepticYear - 1).map { (dayNumber - $0) / CPCCalendarWrapper.daysPerWeek + 1 };
+		}
+		if let nextYearFirstWeekStart = self.gregorianFirstWeekStart (prolepticYear: prolepticYear + 1), dayNumber >= nextYearFirstWeekStart {
+			return 1;
+		}
+		return (dayNumber - firstWeekStart) / CPCCalendarWrapper.daysPerWeek + 1;
+	}
+	
+	private func gregorianFirstWeekStart (prolepticYear: Int) -> Int? {
+		let yearStart = CPCGregorianArithmetic.dayNumber (prolepticYear: prolepticYear, month: 1, day: 1);
+		guard yearStart >= CPCGregorianArithmetic.cutoverDayNumber else {
+			return nil;
+		}
+		
+		let weekStart = self.firstDayNumberOfWeek (containingDayNumber: yearStart);
+		if (CPCCalendarWrapper.daysPerWeek - (yearStart - weekStart) >= self.minimumDaysInFirstWeek) {
+			return weekStart;
+		} else {
+			return weekStart + CPCCalendarWrapper.daysPerWeek;
+		}
+	}
+}
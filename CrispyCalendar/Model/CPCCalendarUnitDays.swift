@@ -0,0 +1,297 @@
+//
+//  CPCCalendarUnitDays.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// Iterator over backing values of consecutive days, which performs at most one calendar computation per month.
+internal struct CPCDayBackingStorageIterator: IteratorProtocol {
+	private let calendar: CPCCalendarWrapper;
+	private var current: CPCDay.BackingStorage;
+	private var lastDayOfMonth: Int;
+	
+	/// Creates a new iterator.
+	///
+	/// - Parameters:
+	///   - start: Backing value of the first day to return.
+	///   - calendar: Calendar to perform calculations with.
+	internal init (startingAt start: CPCDay.BackingStorage, calendar: CPCCalendarWrapper) {
+		self.calendar = calendar;
+		self.current = start;
+		self.lastDayOfMonth = CPCDayBackingStorageIterator.lastDayOfMonth (containing: start, calendar: calendar);
+	}
+	
+	internal static func lastDayOfMonth (containing day: CPCDay.BackingStorage, calendar: CPCCalendarWrapper) -> Int {
+		if calendar.isGregorian, day.gregorianDayNumber != nil {
+			return CPCGregorianArithmetic.numberOfDays (prolepticYear: CPCGregorianArithmetic.prolepticYear (era: day.era, year: day.year), month: day.month);
+		}
+		if let month = calendar.metadataTable?.month (day.containingMonth (calendar), calendar: calendar) {
+			return month.lastDay;
+		}
+		return CPCInstrumentation.measure (.calendarCall, calendar: calendar) { CPCDayBackingStorageIterator.lastDayOfMonth (containing: day, calendar: calendar.calendar) };
+	}
+	
+	/// Calculates last day of a month that contains given day using `Calendar`.
+	///
+	/// Days of a month may belong to different eras (e.g. January 7, 1989 is the last day of Showa era of the Japanese calendar
+	/// and the next day is the first day of Heisei 1), so returned day is the last one that has the same era and year as `day`.
+	///
+	/// - Parameters:
+	///   - day: A day of the month.
+	///   - calendar: Calendar to perform calculations with.
+	/// - Returns: Last day of the month that has the same era and year as `day`.
+	internal static func lastDayOfMonth (containing day: CPCDay.BackingStorage, calendar: Calendar) -> Int {
+		let startDate = day.startDate (using: calendar), lastDay = guarantee (calendar.range (of: .day, in: .month, for: startDate)).upperBound - 1;
+		let sharesEraAndYear = self.eraAndYearPredicate (of: day, startDate: startDate, calendar: calendar);
+		guard !sharesEraAndYear (lastDay) else {
+			return lastDay;
+		}
+		
+		var lowerBound = day.day, upperBound = lastDay;
+		while (upperBound - lowerBound > 1) {
+			let middle = (lowerBound + upperBound) / 2;
+			if sharesEraAndYear (middle) {
+				lowerBound = middle;
+			} else {
+				upperBound = middle;
+			}
+		}
+		return lowerBound;
+	}
+	
+	/// Calculates first day of a month that contains given day.
+	///
+	/// - Parameters:
+	///   - day: A day of the month.
+	///   - calendar: Calendar to perform calculations with.
+	/// - Returns: First day of the month that has the same era and year as `day`; it is greater than 1 only if an era starts in the middle of the month.
+	internal static func firstDayOfMonth (containing day: CPCDay.BackingStorage, calendar: CPCCalendarWrapper) -> Int {
+		if calendar.isGregorian, day.gregorianDayNumber != nil {
+			return 1;
+		}
+		if let month = calendar.metadataTable?.month (day.containingMonth (calendar), calendar: calendar) {
+			return month.firstDay;
+		}
+		return CPCInstrumentation.measure (.calendarCall, calendar: calendar) { CPCDayBackingStorageIterator.firstDayOfMonth (containing: day, calendar: calendar.calendar) };
+	}
+	
+	/// Returns first day of a month; it is not the day 1 if an era starts in the middle of the month.
+	///
+	/// - Parameters:
+	///   - month: Month to look up.
+	///   - calendar: Calendar to perform calculations with.
+	internal static func firstDay (of month: CPCMonth.BackingStorage, calendar: CPCCalendarWrapper) -> CPCDay.BackingStorage {
+		let dayOne = CPCDay.BackingStorage (era: month.era, year: month.year, month: month.month, day: 1);
+		return CPCDay.BackingStorage (era: month.era, year: month.year, month: month.month, day: self.firstDayOfMonth (containing: dayOne, calendar: calendar));
+	}
+	
+	/// Calculates first day of a month that contains given day using `Calendar`.
+	///
+	/// - Parameters:
+	///   - day: A day of the month.
+	///   - calendar: Calendar to perform calculations with.
+	/// - Returns: First day of the month that has the same era and year as `day`.
+	internal static func firstDayOfMonth (containing day: CPCDay.BackingStorage, calendar: Calendar) -> Int {
+		let startDate = day.startDate (using: calendar), firstDay = guarantee (calendar.range (of: .day, in: .month, for: startDate)).lowerBound;
+		let sharesEraAndYear = self.eraAndYearPredicate (of: day, startDate: startDate, calendar: calendar);
+		guard !sharesEraAndYear (firstDay) else {
+			return firstDay;
+		}
+		
+		var lowerBound = firstDay, upperBound = day.day;
+		while (upperBound - lowerBound > 1) {
+			let middle = (lowerBound + upperBound) / 2;
+			if sharesEraAndYear (middle) {
+				upperBound = middle;
+			} else {
+				lowerBound = middle;
+			}
+		}
+		return upperBound;
+	}
+	
+	/// Returns a predicate that checks whether a day of the same month as `day` belongs to the same era and year.
+	private static func eraAndYearPredicate (of day: CPCDay.BackingStorage, startDate: Date, calendar: Calendar) -> (Int) -> Bool {
+		return { candidateDay in
+			let candidate = CPCDay.BackingStorage (containing: guarantee (calendar.date (byAdding: .day, value: candidateDay - day.day, to: startDate)), calendar: calendar);
+			return (candidate.era == day.era) && (candidate.year == day.year) && (candidate.day == candidateDay);
+		};
+	}
+	
+	private static func firstDayOfMonth (following day: CPCDay.BackingStorage, calendar: CPCCalendarWrapper) -> CPCDay.BackingStorage {
+		if calendar.isGregorian, day.gregorianDayNumber != nil {
+			let prolepticYear = CPCGregorianArithmetic.prolepticYear (era: day.era, year: day.year) + ((day.month == 12) ? 1 : 0);
+			let eraAndYear = CPCGregorianArithmetic.eraAndYear (prolepticYear: prolepticYear);
+			return CPCDay.BackingStorage (era: eraAndYear.era, year: eraAndYear.year, month: day.month % 12 + 1, day: 1);
+		}
+		if let table = calendar.metadataTable, let month = table.month (day.containingMonth (calendar), calendar: calendar), let nextMonth = table.month (after: month) {
+			return CPCDay.BackingStorage (era: nextMonth.era, year: nextMonth.year, month: nextMonth.month, day: nextMonth.firstDay);
+		}
+		
+		let nextDayStart = CPCInstrumentation.measure (.calendarCall, calendar: calendar) { guarantee (calendar.calendar.date (byAdding: .day, value: 1, to: day.startDate (using: calendar.calendar))) };
+		return CPCDay.BackingStorage (containing: nextDayStart, calendar: calendar);
+	}
+	
+	internal mutating func next () -> CPCDay.BackingStorage? {
+		let result = self.current;
+		if (self.current.day < self.lastDayOfMonth) {
+			self.current.day += 1;
+		} else {
+			self.current = CPCDayBackingStorageIterator.firstDayOfMonth (following: self.current, calendar: self.calendar);
+			self.lastDayOfMonth = CPCDayBackingStorageIterator.lastDayOfMonth (containing: self.current, calendar: self.calendar);
+		}
+		return result;
+	}
+}
+
+/* internal */ extension CPCDay.BackingStorage {
+	/// Appends backing values of consecutive days to a buffer without querying or populating units caches.
+	///
+	/// - Parameters:
+	///   - start: Backing value of the first appended day.
+	///   - count: Number of days to append.
+	///   - calendar: Calendar to perform calculations with.
+	///   - buffer: Buffer to append values to.
+	internal static func appendDays (startingAt start: CPCDay.BackingStorage, count: Int, calendar: CPCCalendarWrapper, to buffer: inout ContiguousArray <CPCDay.BackingStorage>) {
+		guard count > 0 else {
+			return;
+		}
+		
+		buffer.reserveCapacity (buffer.count + count);
+		var iterator = CPCDayBackingStorageIterator (startingAt: start, calendar: calendar);
+		for _ in 0 ..< count {
+			buffer.append (guarantee (iterator.next ()));
+		}
+	}
+	
+	/// Appends backing values of all days in a half-open range to a buffer without querying or populating units caches.
+	///
+	/// Number of appended days is determined by day numbers of bounds, so the range may end with a day value that is never
+	/// produced by iteration (e.g. a day that precedes an era starting in the middle of a month). Nothing is appended if
+	/// `end` does not follow `start`.
+	///
+	/// - Parameters:
+	///   - start: Backing value of the first appended day.
+	///   - end: Backing value of the day that follows last appended one.
+	///   - calendar: Calendar to perform calculations with.
+	///   - buffer: Buffer to append values to.
+	internal static func appendDays (from start: CPCDay.BackingStorage, to end: CPCDay.BackingStorage, calendar: CPCCalendarWrapper, to buffer: inout ContiguousArray <CPCDay.BackingStorage>) {
+		self.appendDays (startingAt: start, count: end.dayNumber (using: calendar) - start.dayNumber (using: calendar), calendar: calendar, to: &buffer);
+	}
+	
+	/// Appends backing values of consecutive days to a buffer while they satisfy given predicate.
+	fileprivate static func appendDays (startingAt start: CPCDay.BackingStorage, calendar: CPCCalendarWrapper, to buffer: inout ContiguousArray <CPCDay.BackingStorage>, while predicate: (CPCDay.BackingStorage) -> Bool) {
+		var iterator = CPCDayBackingStorageIterator (startingAt: start, calendar: calendar);
+		while let day = iterator.next (), predicate (day) {
+			buffer.append (day);
+		}
+	}
+}
+
+/* internal */ extension CPCDay {
+	/// Appends backing values of all days in a half-open range to a buffer.
+	///
+	/// - Parameters:
+	///   - range: Range of days to append.
+	///   - buffer: Buffer to append values to.
+	internal static func appendBackingValues (of range: Range <CPCDay>, to buffer: inout ContiguousArray <BackingStorage>) {
+		BackingStorage.appendDays (from: range.lowerBound.backingValue, to: range.upperBound.backingValue, calendar: range.lowerBound.calendarWrapper, to: &buffer);
+	}
+}
+
+/* internal */ extension CPCWeek {
+	/// Appends backing values of all days of this week to a buffer.
+	///
+	/// - Parameter buffer: Buffer to append values to.
+	internal func appendDayBackingValues (to buffer: inout ContiguousArray <CPCDay.BackingStorage>) {
+		let calendar = self.calendarWrapper, firstDay = CPCDay.BackingStorage (containing: self.start, calendar: calendar.calendar);
+		CPCDay.BackingStorage.appendDays (startingAt: firstDay, count: self.count, calendar: calendar, to: &buffer);
+	}
+}
+
+/* internal */ extension CPCMonth {
+	/// Appends backing values of all days of this month to a buffer.
+	///
+	/// - Parameter buffer: Buffer to append values to.
+	internal func appendDayBackingValues (to buffer: inout ContiguousArray <CPCDay.BackingStorage>) {
+		let calendar = self.calendarWrapper, month = self.backingValue, firstDay = CPCDay.BackingStorage (containing: self.start, calendar: calendar.calendar);
+		CPCDay.BackingStorage.appendDays (startingAt: firstDay, calendar: calendar, to: &buffer) {
+			($0.month == month.month) && ($0.year == month.year) && ($0.era == month.era);
+		};
+	}
+	
+	/// Appends backing values of all days of all weeks of this month (including days of adjacent months) to a buffer.
+	///
+	/// - Parameter buffer: Buffer to append values to.
+	internal func appendGridDayBackingValues (to buffer: inout ContiguousArray <CPCDay.BackingStorage>) {
+		guard let firstWeek = self.first else {
+			return;
+		}
+		
+		let calendar = self.calendarWrapper, firstDay = CPCDay.BackingStorage (containing: firstWeek.start, calendar: calendar.calendar);
+		CPCDay.BackingStorage.appendDays (startingAt: firstDay, count: self.count * firstWeek.count, calendar: calendar, to: &buffer);
+	}
+	
+	/// Positions of days of a month among days of all its weeks.
+	internal struct GridDayPositions {
+		/// Number of leading days that belong to the previous month.
+		internal let leadingDaysCount: Int;
+		/// Positions of days that belong to the month itself.
+		internal let monthPositions: UInt64;
+		/// Day of the first day of the month; it is greater than 1 only if an era starts in the middle of the month.
+		private let firstDay: Int;
+		
+		/// Locates days of a month among days of its weeks.
+		///
+		/// - Parameters:
+		///   - month: Month to locate days of.
+		///   - gridDays: Backing values of all days of all weeks of the month, as appended by `appendGridDayBackingValues (to:)`.
+		internal init (of month: CPCMonth.BackingStorage, gridDays: ContiguousArray <CPCDay.BackingStorage>) {
+			let isMonthDay: (CPCDay.BackingStorage) -> Bool = { ($0.month == month.month) && ($0.year == month.year) && ($0.era == month.era) };
+			let leadingDaysCount = gridDays.firstIndex (where: isMonthDay) ?? 0, monthDaysCount = gridDays.lazy.filter (isMonthDay).count;
+			self.leadingDaysCount = leadingDaysCount;
+			self.monthPositions = (UInt64.max >> (UInt64.bitWidth - monthDaysCount)) << leadingDaysCount;
+			self.firstDay = (monthDaysCount > 0) ? gridDays [leadingDaysCount].day : 1;
+		}
+		
+		/// Converts a day bitmap of the month to positions of its days.
+		///
+		/// - Parameter dayBitmap: Day bitmap of the month; bit `n` stands for `n + 1`-th day of the month.
+		/// - Returns: Bitmap whose bit `n` is set if `n`-th day of the weeks is contained in `dayBitmap`.
+		internal func positions (ofDays dayBitmap: CPCDaySet.Bitmap) -> UInt64 {
+			let shift = self.leadingDaysCount - (self.firstDay - 1);
+			return (shift < 0) ? (dayBitmap >> -shift) : (dayBitmap << shift);
+		}
+	}
+}
+
+/* internal */ extension CPCYear {
+	/// Appends backing values of all days of this year to a buffer.
+	///
+	/// - Parameter buffer: Buffer to append values to.
+	internal func appendDayBackingValues (to buffer: inout ContiguousArray <CPCDay.BackingStorage>) {
+		let calendar = self.calendarWrapper, year = self.backingValue, firstDay = CPCDay.BackingStorage (containing: self.start, calendar: calendar.calendar);
+		CPCDay.BackingStorage.appendDays (startingAt: firstDay, calendar: calendar, to: &buffer) {
+			($0.year == year.year) && ($0.era == year.era);
+		};
+	}
+}
@@ -0,0 +1,176 @@
+//
+//  CPCCalendarUnitGregorianBacking.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+// MARK: - Gregorian calendar arithmetic
+
+/// Proleptic Gregorian calendar arithmetic, used to bypass Foundation for calendars that share Gregorian days, months & years.
+///
+/// Foundation's Gregorian calendar switches to Julian one before October 15, 1582, so days that precede
+/// `cutoverDayNumber` are always processed by `Calendar` instead.
+internal enum CPCGregorianArithmetic {
+	/// Number of the first Gregorian day (1582-10-15), counted from 1970-01-01.
+	internal static let cutoverDayNumber = -141427;
+	
+	/// Converts era & year pair to an astronomical year number (1 BC is year 0, 2 BC is year -1 and so on).
+	internal static func prolepticYear (era: Int, year: Int) -> Int {
+		return (era > 0) ? year : 1 - year;
+	}
+	
+	/// Converts astronomical year number to era & year pair.
+	internal static func eraAndYear (prolepticYear: Int) -> (era: Int, year: Int) {
+		return (prolepticYear > 0) ? (era: 1, year: prolepticYear) : (era: 0, year: 1 - prolepticYear);
+	}
+	
+	/// Calculates number of days in a given month of a proleptic Gregorian year.
+	internal static func numberOfDays (prolepticYear: Int, month: Int) -> Int {
+		switch (month) {
+		case 2:
+			return ((prolepticYear % 4 == 0) && ((prolepticYear % 100 != 0) || (prolepticYear % 400 == 0))) ? 29 : 28;
+		case 4, 6, 9, 11:
+			return 30;
+		default:
+			return 31;
+		}
+	}
+	
+	/// Calculates number of days between 1970-01-01 and a given civil date.
+	internal static func dayNumber (prolepticYear: Int, month: Int, day: Int) -> Int {
+		let year = (month > 2) ? prolepticYear : prolepticYear - 1;
+		let cycle = ((year >= 0) ? year : year - 399) / 400, yearOfCycle = year - cycle * 400;
+		let dayOfYear = (153 * ((month > 2) ? month - 3 : month + 9) + 2) / 5 + day - 1;
+		let dayOfCycle = yearOfCycle * 365 + yearOfCycle / 4 - yearOfCycle / 100 + dayOfYear;
+		return cycle * 146097 + dayOfCycle - 719468;
+	}
+	
+	/// Calculates civil date for a number of days since 1970-01-01.
+	internal static func date (dayNumber: Int) -> (prolepticYear: Int, month: Int, day: Int) {
+		let shiftedDayNumber = dayNumber + 719468;
+		let cycle = ((shiftedDayNumber >= 0) ? shiftedDayNumber : shiftedDayNumber - 146096) / 146097, dayOfCycle = shiftedDayNumber - cycle * 146097;
+		let yearOfCycle = (dayOfCycle - dayOfCycle / 1460 + dayOfCycle / 36524 - dayOfCycle / 146096) / 365;
+		let dayOfYear = dayOfCycle - (365 * yearOfCycle + yearOfCycle / 4 - yearOfCycle / 100);
+		let shiftedMonth = (5 * dayOfYear + 2) / 153, month = (shiftedMonth < 10) ? shiftedMonth + 3 : shiftedMonth - 9;
+		return (
+			prolepticYear: yearOfCycle + cycle * 400 + ((month <= 2) ? 1 : 0),
+			month: month,
+			day: dayOfYear - (153 * shiftedMonth + 2) / 5 + 1
+		);
+	}
+}
+
+// MARK: - Backing types fast paths
+
+/* internal */ extension CPCDay.BackingStorage {
+	/// Number of days between 1970-01-01 and represented day, or nil if represented day is not a Gregorian one.
+	internal var gregorianDayNumber: Int? {
+		let result = CPCGregorianArithmetic.dayNumber (
+			prolepticYear: CPCGregorianArithmetic.prolepticYear (era: self.era, year: self.year),
+			month: self.month,
+			day: self.day
+		);
+		return (result >= CPCGregorianArithmetic.cutoverDayNumber) ? result : nil;
+	}
+	
+	/// Creates a new storage for a Gregorian day with given number.
+	///
+	/// - Parameter gregorianDayNumber: Number of days since 1970-01-01.
+	internal init? (gregorianDayNumber: Int) {
+		guard gregorianDayNumber >= CPCGregorianArithmetic.cutoverDayNumber else {
+			return nil;
+		}
+		
+		let date = CPCGregorianArithmetic.date (dayNumber: gregorianDayNumber), eraAndYear = CPCGregorianArithmetic.eraAndYear (prolepticYear: date.prolepticYear);
+		self.init (era: eraAndYear.era, year: eraAndYear.year, month: date.month, day: date.day);
+	}
+	
+	internal func distance (to other: CPCDay.BackingStorage, using calendar: CPCCalendarWrapper) -> Int {
+		if calendar.isGregorian, let dayNumber = self.gregorianDayNumber, let otherDayNumber = other.gregorianDayNumber {
+			return otherDayNumber - dayNumber;
+		}
+		return self.calendarDistance (to: other, using: calendar);
+	}
+	
+	internal func advanced (by value: Int, using calendar: CPCCalendarWrapper) -> CPCDay.BackingStorage {
+		if calendar.isGregorian, let dayNumber = self.gregorianDayNumber, let result = CPCDay.BackingStorage (gregorianDayNumber: dayNumber + value) {
+			return result;
+		}
+		return self.calendarAdvanced (by: value, using: calendar);
+	}
+}
+
+/* internal */ extension CPCMonth.BackingStorage {
+	/// Number of months between January, 1970 and represented month in a Gregorian calendar.
+	fileprivate var gregorianMonthNumber: Int {
+		return (CPCGregorianArithmetic.prolepticYear (era: self.era, year: self.year) - 1970) * 12 + self.month - 1;
+	}
+	
+	/// Creates a new storage for a Gregorian month with given number.
+	///
+	/// - Parameter gregorianMonthNumber: Number of months since January, 1970.
+	fileprivate init (gregorianMonthNumber: Int) {
+		let yearsSince1970 = ((gregorianMonthNumber >= 0) ? gregorianMonthNumber : gregorianMonthNumber - 11) / 12;
+		let eraAndYear = CPCGregorianArithmetic.eraAndYear (prolepticYear: yearsSince1970 + 1970), month = gregorianMonthNumber - yearsSince1970 * 12 + 1;
+#if !arch(x86_64) && !arch(arm64)
+		self.init (era: eraAndYear.era, year: eraAndYear.year, month: month, layout: .default);
+#else
+		self.init (era: eraAndYear.era, year: eraAndYear.year, month: month);
+#endif
+	}
+	
+	internal func distance (to other: CPCMonth.BackingStorage, using calendar: CPCCalendarWrapper) -> Int {
+		guard calendar.isGregorian else {
+			return self.calendarDistance (to: other, using: calendar);
+		}
+		return other.gregorianMonthNumber - self.gregorianMonthNumber;
+	}
+	
+	internal func advanced (by value: Int, using calendar: CPCCalendarWrapper) -> CPCMonth.BackingStorage {
+		guard calendar.isGregorian else {
+			return self.calendarAdvanced (by: value, using: calendar);
+		}
+		return CPCMonth.BackingStorage (gregorianMonthNumber: self.gregorianMonthNumber + value);
+	}
+}
+
+/* internal */ extension CPCYear.BackingStorage {
+	internal func distance (to other: CPCYear.BackingStorage, using calendar: CPCCalendarWrapper) -> Int {
+		guard calendar.isGregorian else {
+			return self.calendarDistance (to: other, using: calendar);
+		}
+		return CPCGregorianArithmetic.prolepticYear (era: other.era, year: other.year) - CPCGregorianArithmetic.prolepticYear (era: self.era, year: self.year);
+	}
+	
+	internal func advanced (by value: Int, using calendar: CPCCalendarWrapper) -> CPCYear.BackingStorage {
+		guard calendar.isGregorian else {
+			return self.calendarAdvanced (by: value, using: calendar);
+		}
+		
+		let eraAndYear = CPCGregorianArithmetic.eraAndYear (prolepticYear: CPCGregorianArithmetic.prolepticYear (era: self.era, year: self.year) + value);
+#if !arch(x86_64) && !arch(arm64)
+		return CPCYear.BackingStorage (era: eraAndYear.era, year: eraAndYear.year, layout: .default);
+#else
+		return CPCYear.BackingStorage (era: eraAndYear.era, year: eraAndYear.year);
+#endif
+	}
+}
@@ -0,0 +1,584 @@
+//
+//  CPCCalendarUnitSerialization.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// Compact binary representation of calendar units that share a single calendar.
+///
+/// Stream layout (all fixed-size integers are little-endian, variable-length integers are LEB128-encoded):
+/// * Header: magic (`CPCU`, 4 bytes), format version (1 byte), first weekday (1 byte), minimum days in the first week (1 byte),
+///   calendar identifier, time zone identifier and locale identifier (each prefixed with its length, locale may be empty).
+/// * Records, each starting with a single byte tag. Units are stored as chronologically ordered keys of their backing values,
+///   every key being zigzag-encoded as a difference from the key of the previous unit of the same kind. Sequences of days
+///   are split into runs of consecutive days; day sets are stored as pairs of month keys and day bitmaps. Both are written
+///   in blocks prefixed with the number of their items, zero-sized block ending the sequence.
+///
+/// Ordered keys do not depend on the platform-specific layout of backing storage, so data written on one architecture is
+/// readable on another one. Decoding produces backing values directly and does not query the calendar for every unit;
+/// decoded months and days are only checked against the largest month and day numbers of the calendar.
+internal enum CPCCalendarUnitsFormat {
+	fileprivate static let magic: UInt32 = 0x55435043;
+	fileprivate static let version: UInt8 = 1;
+	fileprivate static let blockSize = 256;
+	
+	fileprivate enum Tag: UInt8 {
+		case day = 1;
+		case month;
+		case year;
+		case dayRange;
+		case days;
+		case daySet;
+		case selection;
+	}
+}
+
+/// Writes calendar units into a stream of compact binary data.
+///
+/// Encoded data is passed to the output handler in chunks, so that arbitrarily large sequences of days may be written
+/// without keeping their whole representation in memory.
+public final class CPCCalendarUnitsEncoder {
+	/// Receives chunks of encoded data in order.
+	public typealias OutputHandler = (Data) -> ();
+	
+	/// Calendar of encoded units.
+	public var calendar: Calendar {
+		return self.calendarWrapper.calendar;
+	}
+	
+	private let calendarWrapper: CPCCalendarWrapper;
+	private let chunkSize: Int;
+	private let outputHandler: OutputHandler;
+	private var buffer = Data ();
+	private var previousDayKey: UInt64 = 0;
+	private var previousMonthKey: UInt64 = 0;
+	private var previousYearKey: UInt64 = 0;
+	
+	/// Creates a new encoder and writes stream header.
+	///
+	/// - Parameters:
+	///   - calendar: Calendar of encoded units. Units of other calendars are converted to this calendar.
+	///   - chunkSize: Approximate size of data chunks that are passed to `outputHandler`.
+	///   - outputHandler: Handler that receives encoded data.
+	public init (calendar: Calendar, chunkSize: Int = 16384, outputHandler: @escaping OutputHandler) {
+		self.calendarWrapper = calendar.wrapped ();
+		self.chunkSize = chunkSize;
+		self.outputHandler = outputHandler;
+		
+		self.buffer.cpc_append (CPCCalendarUnitsFormat.magic);
+		self.buffer.cpc_append (CPCCalendarUnitsFormat.version);
+		self.buffer.cpc_append (UInt8 (calendar.firstWeekday));
+		self.buffer.cpc_append (UInt8 (calendar.minimumDaysInFirstWeek));
+		self.buffer.cpc_appendString ((calendar as NSCalendar).calendarIdentifier.rawValue);
+		self.buffer.cpc_appendString (calendar.timeZone.identifier);
+		self.buffer.cpc_appendString (calendar.locale?.identifier ?? "");
+	}
+	
+	/// Encodes data in memory.
+	///
+	/// - Parameters:
+	///   - calendar: Calendar of encoded units.
+	///   - body: Closure that writes units using the given encoder.
+	/// - Returns: Encoded data.
+	public static func encodedData (calendar: Calendar, using body: (CPCCalendarUnitsEncoder) throws -> ()) rethrows -> Data {
+		var result = Data ();
+		let encoder = CPCCalendarUnitsEncoder (calendar: calendar, chunkSize: .max) { result.append ($0) };
+		try body (encoder);
+		encoder.finish ();
+		return result;
+	}
+	
+	/// Writes a single day.
+	///
+	/// - Parameter day: Day to write.
+	public func encode (_ day: CPCDay) {
+		self.appendTag (.day);
+		self.appendDayKey (self.converted (day).backingValue.orderedKey (using: self.calendarWrapper));
+		self.flushIfNeeded ();
+	}
+	
+	/// Writes a single month.
+	///
+	/// - Parameter month: Month to write.
+	public func encode (_ month: CPCMonth) {
+		let calendar = self.calendarWrapper, month = (month.calendarWrapper === calendar) ? month : CPCMonth (containing: month.start, calendar: calendar);
+		let key = month.backingValue.orderedKey (using: calendar) >> 8;
+		self.appendTag (.month);
+		self.buffer.cpc_appendDelta (from: self.previousMonthKey, to: key);
+		self.previousMonthKey = key;
+		self.flushIfNeeded ();
+	}
+	
+	/// Writes a single year.
+	///
+	/// - Parameter year: Year to write.
+	public func encode (_ year: CPCYear) {
+		let calendar = self.calendarWrapper, year = (year.calendarWrapper === calendar) ? year : CPCYear (containing: year.start, calendar: calendar);
+		let key = year.backingValue.orderedKey (using: calendar) >> 16;
+		self.appendTag (.year);
+		self.buffer.cpc_appendDelta (from: self.previousYearKey, to: key);
+		self.previousYearKey = key;
+		self.flushIfNeeded ();
+	}
+	
+	/// Writes a range of days.
+	///
+	/// - Parameter days: Range of days to write.
+	public func encode (_ days: CountableRange <CPCDay>) {
+		let lowerKey = self.converted (days.lowerBound).backingValue.orderedKey (using: self.calendarWrapper);
+		let upperKey = self.converted (days.upperBound).backingValue.orderedKey (using: self.calendarWrapper);
+		self.appendTag (.dayRange);
+		self.appendDayKey (lowerKey);
+		self.buffer.cpc_appendVarint (upperKey &- lowerKey);
+		self.previousDayKey = upperKey;
+		self.flushIfNeeded ();
+	}
+	
+	/// Writes a sequence of days preserving their order. Sorted sequences are written most compactly.
+	///
+	/// - Parameter days: Days to write.
+	public func encode <S> (_ days: S) where S: Sequence, S.Element == CPCDay {
+		var runs = ContiguousArray <(start: UInt64, length: UInt64)> ();
+		runs.reserveCapacity (CPCCalendarUnitsFormat.blockSize);
+		
+		self.appendTag (.days);
+		for day in days {
+			let key = self.converted (day).backingValue.orderedKey (using: self.calendarWrapper);
+			if let lastRun = runs.last, key == lastRun.start &+ lastRun.length {
+				runs [runs.count - 1].length += 1;
+				continue;
+			}
+			if (runs.count == CPCCalendarUnitsFormat.blockSize) {
+				self.appendDayRuns (runs);
+				runs.removeAll (keepingCapacity: true);
+			}
+			runs.append ((start: key, length: 1));
+		}
+		if (!runs.isEmpty) {
+			self.appendDayRuns (runs);
+		}
+		self.buffer.cpc_appendVarint (0);
+		self.flushIfNeeded ();
+	}
+	
+	/// Writes a set of days.
+	///
+	/// - Parameter days: Set of days to write.
+	public func encode (_ days: CPCDaySet) {
+		let calendar = self.calendarWrapper;
+		let bitmaps = ((days.calendarWrapper ?? calendar) === calendar) ? days.bitmaps : CPCDaySet (days.lazy.map { self.converted ($0) }).bitmaps;
+		let months = bitmaps.map { (key: $0.key.orderedKey (using: calendar) >> 8, bitmap: $0.value) }.sorted { $0.key < $1.key };
+		
+		self.appendTag (.daySet);
+		var blockStart = months.startIndex;
+		while (blockStart < months.endIndex) {
+			let block = months [blockStart ..< min (blockStart + CPCCalendarUnitsFormat.blockSize, months.endIndex)];
+			self.buffer.cpc_appendVarint (UInt64 (block.count));
+			for month in block {
+				self.buffer.cpc_appendDelta (from: self.previousMonthKey, to: month.key);
+				self.buffer.cpc_appendVarint (month.bitmap);
+				self.previousMonthKey = month.key;
+			}
+			self.flushIfNeeded ();
+			blockStart = block.endIndex;
+		}
+		self.buffer.cpc_appendVarint (0);
+		self.flushIfNeeded ();
+	}
+	
+	/// Passes all pending data to the output handler. Must be called after all units are written.
+	public func finish () {
+		guard !self.buffer.isEmpty else {
+			return;
+		}
+		self.outputHandler (self.buffer);
+		self.buffer.removeAll (keepingCapacity: true);
+	}
+}
+
+/* internal */ extension CPCCalendarUnitsEncoder {
+	internal func encodeSelectionKind (_ kind: UInt8) {
+		self.appendTag (.selection);
+		self.buffer.cpc_append (kind);
+	}
+}
+
+/* fileprivate */ extension CPCCalendarUnitsEncoder {
+	private func converted (_ day: CPCDay) -> CPCDay {
+		return (day.calendarWrapper === self.calendarWrapper) ? day : CPCDay (containing: day.start, calendar: self.calendarWrapper);
+	}
+	
+	private func appendTag (_ tag: CPCCalendarUnitsFormat.Tag) {
+		self.buffer.cpc_append (tag.rawValue);
+	}
+	
+	private func appendDayKey (_ key: UInt64) {
+		self.buffer.cpc_appendDelta (from: self.previousDayKey, to: key);
+		self.previousDayKey = key;
+	}
+	
+	private func appendDayRuns (_ runs: ContiguousArray <(start: UInt64, length: UInt64)>) {
+		self.buffer.cpc_appendVarint (UInt64 (runs.count));
+		for run in runs {
+			self.appendDayKey (run.start);
+			self.buffer.cpc_appendVarint (run.length - 1);
+			self.previousDayKey = run.start &+ (run.length - 1);
+		}
+		self.flushIfNeeded ();
+	}
+	
+	private func flushIfNeeded () {
+		if (self.buffer.count >= self.chunkSize) {
+			self.finish ();
+		}
+	}
+}
+
+/// Reads calendar units from a stream of compact binary data written by `CPCCalendarUnitsEncoder`.
+///
+/// Units must be read in the same order and using the same kinds as they were written.
+public final class CPCCalendarUnitsDecoder {
+	/// Supplies next chunk of encoded data or `nil` when no more data is available.
+	public typealias InputHandler = () -> Data?;
+	
+	/// Errors that are thrown when encoded data cannot be decoded.
+	public enum Error: Swift.Error {
+		/// Stream header is malformed.
+		case invalidHeader;
+		/// Stream is written using unknown version of the format.
+		case unsupportedVersion (Int);
+		/// Stream ended in the middle of a record.
+		case unexpectedEndOfData;
+		/// Stream contains a record of a kind different from the requested one.
+		case unexpectedRecord (tag: Int);
+		/// Record contents are malformed.
+		case malformedRecord;
+	}
+	
+	/// Calendar of decoded units.
+	public var calendar: Calendar {
+		return self.calendarWrapper.calendar;
+	}
+	
+	internal let calendarWrapper: CPCCalendarWrapper;
+	/// Largest month number of the decoded calendar.
+	private let maximumMonth: Int;
+	/// Largest day number of a month of the decoded calendar.
+	private let maximumDay: Int;
+	private let inputHandler: InputHandler;
+	private var buffer: Data;
+	private var offset: Int;
+	private var previousDayKey: UInt64 = 0;
+	private var previousMonthKey: UInt64 = 0;
+	private var previousYearKey: UInt64 = 0;
+	
+	/// Creates a new decoder and reads stream header.
+	///
+	/// - Parameter inputHandler: Handler that supplies encoded data.
+	public init (inputHandler: @escaping InputHandler) throws {
+		var reader = CPCCalendarUnitsReader (inputHandler: inputHandler);
+		guard try reader.readFixed (UInt32.self) == CPCCalendarUnitsFormat.magic else {
+			throw Error.invalidHeader;
+		}
+		let version = try reader.readFixed (UInt8.self);
+		guard version == CPCCalendarUnitsFormat.version else {
+			throw Error.unsupportedVersion (Int (version));
+		}
+		
+		let firstWeekday = try reader.readFixed (UInt8.self), minimumDaysInFirstWeek = try reader.readFixed (UInt8.self);
+		let identifier = try reader.readString (), timeZoneIdentifier = try reader.readString (), localeIdentifier = try reader.readString ();
+		guard let nsCalendar = NSCalendar (identifier: NSCalendar.Identifier (rawValue: identifier)), let timeZone = TimeZone (identifier: timeZoneIdentifier) else {
+			throw Error.invalidHeader;
+		}
+		
+		var calendar = nsCalendar as Calendar;
+		calendar.timeZone = timeZone;
+		calendar.locale = localeIdentifier.isEmpty ? nil : Locale (identifier: localeIdentifier);
+		calendar.firstWeekday = Int (firstWeekday);
+		calendar.minimumDaysInFirstWeek = Int (minimumDaysInFirstWeek);
+		
+		self.calendarWrapper = calendar.wrapped ();
+		self.maximumMonth = (calendar.maximumRange (of: .month)?.upperBound ?? 14) - 1;
+		self.maximumDay = (calendar.maximumRange (of: .day)?.upperBound ?? 32) - 1;
+		self.inputHandler = inputHandler;
+		self.buffer = reader.buffer;
+		self.offset = reader.offset;
+	}
+	
+	/// Creates a new decoder that reads data from memory.
+	///
+	/// - Parameter data: Encoded data.
+	public convenience init (data: Data) throws {
+		var remainingData: Data? = data;
+		try self.init (inputHandler: {
+			defer { remainingData = nil };
+			return remainingData;
+		});
+	}
+	
+	/// Reads a single day.
+	///
+	/// - Returns: Decoded day.
+	public func decodeDay () throws -> CPCDay {
+		try self.readTag (.day);
+		return try self.day (forKey: try self.readDayKey ());
+	}
+	
+	/// Reads a single month.
+	///
+	/// - Returns: Decoded month.
+	public func decodeMonth () throws -> CPCMonth {
+		try self.readTag (.month);
+		let key = try self.readDelta (from: self.previousMonthKey);
+		self.previousMonthKey = key;
+		return CPCMonth (backedBy: try self.monthValue (forKey: key), calendar: self.calendarWrapper);
+	}
+	
+	/// Reads a single year.
+	///
+	/// - Returns: Decoded year.
+	public func decodeYear () throws -> CPCYear {
+		try self.readTag (.year);
+		let key = try self.readDelta (from: self.previousYearKey);
+		self.previousYearKey = key;
+		return CPCYear (backedBy: CPCDay.BackingStorage (orderedKey: (key << 16) | 0x81, using: self.calendarWrapper).containingYear (self.calendarWrapper), calendar: self.calendarWrapper);
+	}
+	
+	/// Reads a range of days.
+	///
+	/// - Returns: Decoded range of days.
+	public func decodeDayRange () throws -> CountableRange <CPCDay> {
+		try self.readTag (.dayRange);
+		let lowerKey = try self.readDayKey (), length = try self.readVarint (), upperKey = lowerKey &+ length;
+		guard upperKey >= lowerKey else {
+			throw Error.malformedRecord;
+		}
+		self.previousDayKey = upperKey;
+		return CountableRange (uncheckedBounds: (lower: try self.day (forKey: lowerKey), upper: try self.day (forKey: upperKey)));
+	}
+	
+	/// Reads a sequence of days, passing each of them to a closure as soon as it is decoded.
+	///
+	/// - Parameter body: Closure that receives decoded days in their original order.
+	public func decodeDays (_ body: (CPCDay) throws -> ()) throws {
+		try self.readTag (.days);
+		var runsCount = try self.readBlockSize ();
+		while (runsCount > 0) {
+			for _ in 0 ..< runsCount {
+				let start = try self.readDayKey (), startValue = try self.dayValue (forKey: start), lastOffset = try self.readVarint ();
+				// Runs never cross month boundaries, so the last day must be a valid day of the same month.
+				guard lastOffset < UInt64 (self.maximumDay - startValue.day + 1) else {
+					throw Error.malformedRecord;
+				}
+				for offset in 0 ... lastOffset {
+					try body (self.day (forKey: start &+ offset));
+				}
+				self.previousDayKey = start &+ lastOffset;
+			}
+			runsCount = try self.readBlockSize ();
+		}
+	}
+	
+	/// Reads a sequence of days.
+	///
+	/// - Returns: Decoded days in their original order.
+	public func decodeDays () throws -> [CPCDay] {
+		var result = [CPCDay] ();
+		try self.decodeDays { result.append ($0) };
+		return result;
+	}
+	
+	/// Reads a set of days.
+	///
+	/// - Returns: Decoded set of days.
+	public func decodeDaySet () throws -> CPCDaySet {
+		try self.readTag (.daySet);
+		var bitmaps = [CPCDaySet.MonthKey: CPCDaySet.Bitmap] ();
+		var monthsCount = try self.readBlockSize ();
+		while (monthsCount > 0) {
+			bitmaps.reserveCapacity (bitmaps.count + monthsCount);
+			for _ in 0 ..< monthsCount {
+				let key = try self.readDelta (from: self.previousMonthKey), bitmap = try self.readVarint ();
+				guard (bitmap >> UInt64 (self.maximumDay)) == 0 else {
+					throw Error.malformedRecord;
+				}
+				self.previousMonthKey = key;
+				bitmaps [try self.monthValue (forKey: key)] = bitmap;
+			}
+			monthsCount = try self.readBlockSize ();
+		}
+		return CPCDaySet (calendarWrapper: self.calendarWrapper, monthBitmaps: bitmaps);
+	}
+}
+
+/* internal */ extension CPCCalendarUnitsDecoder {
+	internal func decodeSelectionKind () throws -> UInt8 {
+		try self.readTag (.selection);
+		return try self.readByte ();
+	}
+}
+
+/* fileprivate */ extension CPCCalendarUnitsDecoder {
+	private func readByte () throws -> UInt8 {
+		while (self.offset == self.buffer.count) {
+			guard let nextChunk = self.inputHandler () else {
+				throw Error.unexpectedEndOfData;
+			}
+			(self.buffer, self.offset) = (nextChunk, 0);
+		}
+		defer { self.offset += 1 };
+		return self.buffer [self.buffer.startIndex + self.offset];
+	}
+	
+	private func readVarint () throws -> UInt64 {
+		var result: UInt64 = 0;
+		for shift in stride (from: 0, to: UInt64.bitWidth, by: 7) {
+			let byte = try self.readByte ();
+			result |= UInt64 (byte & 0x7F) << shift;
+			if (byte & 0x80 == 0) {
+				return result;
+			}
+		}
+		throw Error.malformedRecord;
+	}
+	
+	private func readDelta (from previousKey: UInt64) throws -> UInt64 {
+		let zigzag = try self.readVarint ();
+		return previousKey &+ ((zigzag >> 1) ^ (0 &- (zigzag & 1)));
+	}
+	
+	/// Reads number of items in the next block of a sequence; blocks are never larger than `CPCCalendarUnitsFormat.blockSize`.
+	private func readBlockSize () throws -> Int {
+		let result = try self.readVarint ();
+		guard result <= CPCCalendarUnitsFormat.blockSize else {
+			throw Error.malformedRecord;
+		}
+		return Int (result);
+	}
+	
+	private func readDayKey () throws -> UInt64 {
+		let key = try self.readDelta (from: self.previousDayKey);
+		self.previousDayKey = key;
+		return key;
+	}
+	
+	private func readTag (_ expectedTag: CPCCalendarUnitsFormat.Tag) throws {
+		let tag = try self.readByte ();
+		guard tag == expectedTag.rawValue else {
+			throw Error.unexpectedRecord (tag: Int (tag));
+		}
+	}
+	
+	private func dayValue (forKey key: UInt64) throws -> CPCDay.BackingStorage {
+		let result = CPCDay.BackingStorage (orderedKey: key, using: self.calendarWrapper);
+		guard (1 ... self.maximumMonth) ~= abs (result.month), (1 ... self.maximumDay) ~= result.day else {
+			throw Error.malformedRecord;
+		}
+		return result;
+	}
+	
+	private func monthValue (forKey key: UInt64) throws -> CPCMonth.BackingStorage {
+		return try self.dayValue (forKey: (key << 8) | 0x81).containingMonth (self.calendarWrapper);
+	}
+	
+	private func day (forKey key: UInt64) throws -> CPCDay {
+		return CPCDay (backedBy: try self.dayValue (forKey: key), calendar: self.calendarWrapper);
+	}
+}
+
+/// Reads stream header before decoder is fully initialized.
+private struct CPCCalendarUnitsReader {
+	fileprivate let inputHandler: CPCCalendarUnitsDecoder.InputHandler;
+	fileprivate var buffer = Data ();
+	fileprivate var offset = 0;
+	
+	fileprivate init (inputHandler: @escaping CPCCalendarUnitsDecoder.InputHandler) {
+		self.inputHandler = inputHandler;
+	}
+	
+	fileprivate mutating func readBytes (_ count: Int) throws -> Data {
+		var result = Data ();
+		while (result.count < count) {
+			if (self.offset == self.buffer.count) {
+				guard let nextChunk = self.inputHandler () else {
+					throw CPCCalendarUnitsDecoder.Error.unexpectedEndOfData;
+				}
+				(self.buffer, self.offset) = (Data (nextChunk), 0);
+				continue;
+			}
+			let chunkEnd = min (self.buffer.count, self.offset + count - result.count);
+			result.append (self.buffer [self.offset ..< chunkEnd]);
+			self.offset = chunkEnd;
+		}
+		return result;
+	}
+	
+	fileprivate mutating func readFixed <T> (_ type: T.Type) throws -> T where T: FixedWidthInteger {
+		return try self.readBytes (MemoryLayout <T>.size).cpc_load (T.self, at: 0);
+	}
+	
+	fileprivate mutating func readString () throws -> String {
+		var length = 0;
+		for shift in stride (from: 0, to: Int.bitWidth, by: 7) {
+			let byte = try self.readFixed (UInt8.self);
+			length |= Int (byte & 0x7F) << shift;
+			if (byte & 0x80 == 0) {
+				break;
+			}
+		}
+		guard let result = String (data: try self.readBytes (length), encoding: .utf8) else {
+			throw CPCCalendarUnitsDecoder.Error.invalidHeader;
+		}
+		return result;
+	}
+}
+
+/* fileprivate */ extension Data {
+	fileprivate func cpc_load <T> (_ type: T.Type, at offset: Int) -> T where T: FixedWidthInteger {
+		return self.withUnsafeBytes { T (littleEndian: $0.load (fromByteOffset: offset, as: T.self)) };
+	}
+	
+	fileprivate mutating func cpc_append <T> (_ value: T) where T: FixedWidthInteger {
+		var value = value.littleEndian;
+		Swift.withUnsafeBytes (of: &value) { self.append (contentsOf: $0) };
+	}
+	
+	fileprivate mutating func cpc_appendVarint (_ value: UInt64) {
+		var value = value;
+		while (value >= 0x80) {
+			self.append (UInt8 (truncatingIfNeeded: value) | 0x80);
+			value >>= 7;
+		}
+		self.append (UInt8 (value));
+	}
+	
+	fileprivate mutating func cpc_appendDelta (from previousKey: UInt64, to key: UInt64) {
+		let delta = Int64 (bitPattern: key &- previousKey);
+		self.cpc_appendVarint (UInt64 (bitPattern: (delta << 1) ^ (delta >> 63)));
+	}
+	
+	fileprivate mutating func cpc_appendString (_ string: String) {
+		let bytes = Data (string.utf8);
+		self.cpc_appendVarint (UInt64 (bytes.count));
+		self.append (bytes);
+	}
+}
@@ -22,6 +22,9 @@
 //
 
 import Foundation
+#if SWIFT_PACKAGE
+@_exported import CrispyCalendarCore
+#endif
 
 /// Calendar unit that has a localizable symbol in addition to an integer value.
 public protocol CPCCalendarUnitSymbol {
@@ -36,7 +36,7 @@ internal protocol CPCCalendarUnitSymbolImpl: CPCCalendarUnit, CPCCalendarUnitSym
 
 extension CPCCalendarUnitSymbolImpl {	
 	public func symbol (style: Style, standalone: Bool) -> String {
-		return self.calendar [keyPath: guarantee ((standalone ? Self.standaloneSymbolKeyPaths : Self.symbolKeyPaths) [style])] [self.unitOrdinalValue];
+		return self.calendarWrapper.stringTable.symbols (guarantee ((standalone ? Self.standaloneSymbolKeyPaths : Self.symbolKeyPaths) [style])) [self.unitOrdinalValue];
 	}
 }
 
@@ -71,8 +71,7 @@ extension CPCDay.Weekday: CPCCalendarUnitSymbol {
 	
 	/// Day of week for represented day.
 	public var weekday: Int {
-		let week = self.day.containingWeek;
-		return (guarantee (week.first).distance (to: self.day) + self.day.calendar.firstWeekday - 1) % week.count + 1;
+		return CPCCalendarWrapper.weekday (ofDayNumber: self.day.backingValue.dayNumber (using: self.day.calendarWrapper));
 	}
 	
 	/// Indicates whether represented day belongs to weekend.
@@ -81,7 +80,7 @@ extension CPCDay.Weekday: CPCCalendarUnitSymbol {
 	}
 
 	public func symbol (style: Style, standalone: Bool) -> String {
-		let weekdaySymbols = self.day.calendar [keyPath: guarantee ((standalone ? Weekday.standaloneSymbolKeyPaths : Weekday.symbolKeyPaths) [style])];
+		let weekdaySymbols = self.day.calendarWrapper.stringTable.symbols (guarantee ((standalone ? Weekday.standaloneSymbolKeyPaths : Weekday.symbolKeyPaths) [style]));
 		return weekdaySymbols [(self.weekday - 1) % weekdaySymbols.count];
 	}
 }
@@ -21,19 +21,23 @@
 //  THE SOFTWARE.
 //
 
-#import <Foundation/Foundation.h>
+#if __has_include (<CoreFoundation/CFBase.h>)
+#include <CoreFoundation/CFBase.h>
+#else
+#include "CPCCoreFoundationCompatibility.h"
+#endif
 
 /**
  Represents style of a localized string representing a calendar unit.
  */
-typedef NS_ENUM (NSInteger, CPCCalendarUnitSymbolStyle) {
+typedef CF_ENUM (CFIndex, CPCCalendarUnitSymbolStyle) {
 	/** Full localized name of a calendar unit.
 	 */
-	CPCCalendarUnitSymbolNormalStyle NS_SWIFT_NAME(normal),
+	CPCCalendarUnitSymbolNormalStyle CF_SWIFT_NAME(normal),
 	/** Shortened localized name of calendar unit. Usually consists of just several letters.
 	 */
-	CPCCalendarUnitSymbolShortStyle NS_SWIFT_NAME(short),
+	CPCCalendarUnitSymbolShortStyle CF_SWIFT_NAME(short),
 	/** The very shortest localized name for a calendar unit. Usually contains just a single letter.
 	 */
-	CPCCalendarUnitSymbolVeryShortStyle NS_SWIFT_NAME(veryShort),
-} NS_SWIFT_NAME(CPCCalendarUnitSymbolStyle);
+	CPCCalendarUnitSymbolVeryShortStyle CF_SWIFT_NAME(veryShort),
+} CF_SWIFT_NAME(CPCCalendarUnitSymbolStyle);
@@ -26,118 +26,212 @@ import Foundation
 /// Wraps a Calendar instance into a reference type to enable short-circuit equality evaluation using identity operator.
 @usableFromInline
 internal final class CPCCalendarWrapper: NSObject {
-	private static var instances = UnfairThreadsafeStorage (UnownedDictionary <Calendar, CPCCalendarWrapper> ());
+	private static var instances = SnapshotThreadsafeStorage (UnownedDictionary <CPCCalendarFingerprint, CPCCalendarWrapper> ());
 	
 	internal static var currentUsed: CPCCalendarWrapper {
-		return Calendar.currentUsed.wrapped ();
+		return CPCCurrentCalendarCache.shared.wrapper;
 	}
 	
 	/// Wrapped Calendar instance
 	internal let calendar: Calendar;
+	/// Values of the wrapped calendar that affect calculations.
+	internal let fingerprint: CPCCalendarFingerprint;
+	/// Indicates that days, months and years of the wrapped calendar match ones of the Gregorian calendar.
+	internal let isGregorian: Bool;
+	/// Indicates that years of the first era of the wrapped calendar are numbered backwards (e.g. BC years).
+	internal let hasDescendingFirstEraYears: Bool;
+	/// First weekday of the wrapped calendar.
+	internal let firstWeekday: Int;
+	/// Minimum number of days in the first week of a year of the wrapped calendar.
+	internal let minimumDaysInFirstWeek: Int;
 	private let calendarHashValue: Int;
 	
 	internal override var hash: Int {
 		return self.calendarHashValue;
 	}
 
-	internal var unitSpecificCaches = UnfairThreadsafeStorage ([ObjectIdentifier: AnyObject & UnitSpecificCacheProtocol] ());
-	internal var commonUnitCaches = UnfairThreadsafeStorage ([ObjectIdentifier: AnyObject & CommonUnitValuesCacheProtocol] ());
+	internal var unitSpecificCaches = PThreadRWLockStorage ([ObjectIdentifier: AnyObject & UnitSpecificCacheProtocol] ());
+	internal var commonUnitCaches = PThreadRWLockStorage ([ObjectIdentifier: AnyObject & CommonUnitValuesCacheProtocol] ());
+	internal var unitIndicesTable = SnapshotThreadsafeStorage (CPCCompoundCalendarUnitIndicesTable ());
+	internal var metadataTableState = UnfairThreadsafeStorage (CPCCalendarMetadataTable.State.unloaded);
+	/// Retained loaded metadata table, published once for lock-free reads.
+	internal let publishedMetadataTable: UnsafeMutablePointer <UnsafeMutableRawPointer?>;
+	internal var stringTableStorage = UnfairThreadsafeStorage (CPCCalendarStringTable?.none);
+#if CPC_INSTRUMENTATION
+	internal let instrumentationCounters: CPCInstrumentationCounters;
+#endif
 	
-	private var lastCachesPurgeTimestamp = Date.timeIntervalSinceReferenceDate;
-	private var mainRunLoopObserver: CFRunLoopObserver?;
-	private var mainRunLoopObserverRefCount = 0;
+	private var garbageCollectorRefCount = 0;
 	
 	internal static func == (lhs: CPCCalendarWrapper, rhs: CPCCalendarWrapper) -> Bool {
 		return (lhs === rhs);
 	}
 	
 	fileprivate static func wrap (_ calendar: Calendar) -> CPCCalendarWrapper {
-		return self.instances.withMutableStoredValue {
-			if let existingWrapper = $0 [calendar] {
-				return existingWrapper;
-			}
-			
-			let wrapper = CPCCalendarWrapper (calendar);
-			$0 [calendar] = wrapper;
-			return wrapper;
-		};
+		let threadCache = ThreadCache.current;
+		if let cachedWrapper = threadCache.wrapper (for: calendar) {
+			return cachedWrapper;
+		}
+		
+		let fingerprint = CPCCalendarFingerprint (calendar);
+		let wrapper: CPCCalendarWrapper;
+		if let existingWrapper = self.instances.withStoredValue ({ $0 [fingerprint] }) {
+			wrapper = existingWrapper;
+		} else {
+			wrapper = self.instances.withMutableStoredValue {
+				if let existingWrapper = $0 [fingerprint] {
+					return existingWrapper;
+				}
+				
+				let wrapper = CPCCalendarWrapper (calendar, fingerprint: fingerprint);
+				$0 [fingerprint] = wrapper;
+				return wrapper;
+			};
+		}
+		
+		threadCache.insert (wrapper, for: calendar);
+		return wrapper;
 	}
 	
 	/// Initializes a new CalendarWrapper
 	///
-	/// - Parameter calendar: Calendar to wrap
-	private init (_ calendar: Calendar) {
+	/// - Parameters:
+	///   - calendar: Calendar to wrap
+	///   - fingerprint: Precomputed fingerprint of `calendar`.
+	private init (_ calendar: Calendar, fingerprint: CPCCalendarFingerprint) {
 		self.calendar = calendar;
+		self.fingerprint = fingerprint;
+		self.isGregorian = (calendar.identifier == .gregorian) || (calendar.identifier == .iso8601);
+		self.hasDescendingFirstEraYears = self.isGregorian || CPCCalendarWrapper.hasDescendingFirstEraYears (calendar);
+		self.firstWeekday = calendar.firstWeekday;
+		self.minimumDaysInFirstWeek = calendar.minimumDaysInFirstWeek;
 		self.calendarHashValue = calendar.hashValue;
+		self.publishedMetadataTable = .allocate (capacity: 1);
+		self.publishedMetadataTable.initialize (to: nil);
+#if CPC_INSTRUMENTATION
+		self.instrumentationCounters = CPCInstrumentation.counters (for: fingerprint);
+#endif
 		super.init ();
+		CPCCalendarCacheManager.shared.register (self);
+	}
+	
+	/// Checks whether years of the first era of a calendar are numbered backwards, like BC years of the Gregorian calendar
+	/// or years before Diocletian of the Coptic one.
+	///
+	/// - Parameter calendar: Calendar to perform check for.
+	private static func hasDescendingFirstEraYears (_ calendar: Calendar) -> Bool {
+		guard let firstYearStart = calendar.date (from: DateComponents (era: 0, year: 1, month: 1, day: 1)),
+			let secondYearStart = calendar.date (from: DateComponents (era: 0, year: 2, month: 1, day: 1)),
+			calendar.component (.era, from: firstYearStart) == 0,
+			calendar.component (.era, from: secondYearStart) == 0 else {
+			return false;
+		}
+		return secondYearStart < firstYearStart;
 	}
 	
 	deinit {
-		self.unscheduleGarbageCollector ();
+		self.releaseUnusedCaches ();
 		CPCCalendarWrapper.instances.withMutableStoredValue { [unowned self] caches in
-			caches [self.calendar] = nil;
+			caches [self.fingerprint] = nil;
 		};
+		if let publishedTable = self.publishedMetadataTable.pointee {
+			Unmanaged <CPCCalendarMetadataTable>.fromOpaque (publishedTable).release ();
+		}
+		self.publishedMetadataTable.deallocate ();
 	}
 	
 	internal func retainGarbageCollector () {
 		guard Thread.isMainThread else {
 			return DispatchQueue.main.sync (execute: self.retainGarbageCollector);
 		}
-		if (self.mainRunLoopObserverRefCount == 0) {
-			self.scheduleGarbageCollector ();
-		}
-		self.mainRunLoopObserverRefCount += 1;
+		self.garbageCollectorRefCount += 1;
 	}
 	
 	internal func releaseGarbageCollector () {
 		guard Thread.isMainThread else {
 			return DispatchQueue.main.sync (execute: self.releaseGarbageCollector);
 		}
-		guard self.mainRunLoopObserverRefCount > 0 else {
+		guard self.garbageCollectorRefCount > 0 else {
 			return;
 		}
-		self.mainRunLoopObserverRefCount -= 1;
-		if (self.mainRunLoopObserverRefCount == 0) {
-			self.unscheduleGarbageCollector ();
+		self.garbageCollectorRefCount -= 1;
+		if (self.garbageCollectorRefCount == 0) {
+			self.releaseUnusedCaches ();
 		}
 	}
 	
-	private func scheduleGarbageCollector () {
-		var context = Unmanaged <CPCCalendarWrapper>.makeRunLoopObserverContext (observer: self);
-		let observer = CFRunLoopObserverCreate (kCFAllocatorDefault, CFRunLoopActivity.beforeWaiting.rawValue, true, 0, CPCCalendarViewMainRunLoopObserver, &context);
-		self.mainRunLoopObserver = observer;
-		CFRunLoopAddObserver (CFRunLoopGetMain (), observer, CFRunLoopMode.commonModes);
-	}
-	
-	private func unscheduleGarbageCollector () {
-		if let mainRunLoopObserver = self.mainRunLoopObserver {
-			CFRunLoopRemoveObserver (CFRunLoopGetMain (), mainRunLoopObserver, CFRunLoopMode.commonModes);
-			self.mainRunLoopObserver = nil;
-		};
-		self.purgeCacheIfNeeded ();
+	private func releaseUnusedCaches () {
+		CPCCalendarCacheManager.shared.setNeedsPurge ();
 		self.invalidateCommonUnitsCaches ();
 		DateFormatter.eraseCachedFormatters (calendar: self);
+		self.stringTableStorage.withMutableStoredValue { $0 = nil };
 	}
 	
 	internal override func isEqual (_ object: Any?) -> Bool {
 		return self === object as? CPCCalendarWrapper;
 	}
-	
-	internal func mainRunLoopWillStartWaiting () {
-		let currentTimestamp = Date.timeIntervalSinceReferenceDate;
-		guard (currentTimestamp - self.lastCachesPurgeTimestamp) > 10.0 else {
-			return;
+}
+
+/* fileprivate */ extension CPCCalendarWrapper {
+	/// Small per-thread cache of recently wrapped calendars that is consulted before the global instances table.
+	///
+	/// Lookups compare calendars for equality, which succeeds immediately for copies of the same `Calendar` value,
+	/// and take no locks.
+	fileprivate final class ThreadCache {
+		private struct Entry {
+			fileprivate let calendar: Calendar;
+			fileprivate weak var wrapper: CPCCalendarWrapper?;
+		}
+		
+		private static let threadDictionaryKey = "CrispyCalendar.CPCCalendarWrapper.ThreadCache" as NSString;
+		private static let capacity = 4;
+		
+		fileprivate static var current: ThreadCache {
+			let threadDictionary = Thread.current.threadDictionary;
+			if let cache = threadDictionary [self.threadDictionaryKey] as? ThreadCache {
+				return cache;
+			}
+			
+			let cache = ThreadCache ();
+			threadDictionary [self.threadDictionaryKey] = cache;
+			return cache;
+		}
+		
+		private var entries = ContiguousArray <Entry> ();
+		
+		fileprivate func wrapper (for calendar: Calendar) -> CPCCalendarWrapper? {
+			for entry in self.entries where entry.calendar == calendar {
+				return entry.wrapper;
+			}
+			return nil;
+		}
+		
+		fileprivate func insert (_ wrapper: CPCCalendarWrapper, for calendar: Calendar) {
+			if let entryIndex = self.entries.firstIndex (where: { $0.calendar == calendar }) {
+				self.entries.remove (at: entryIndex);
+			} else if (self.entries.count >= ThreadCache.capacity) {
+				self.entries.removeLast ();
+			}
+			self.entries.insert (Entry (calendar: calendar, wrapper: wrapper), at: 0);
 		}
-		self.lastCachesPurgeTimestamp = currentTimestamp;
-		self.purgeCacheIfNeeded ();
 	}
 }
 
-private func CPCCalendarViewMainRunLoopObserver (observer: CFRunLoopObserver!, activity: CFRunLoopActivity, calendarPtr: UnsafeMutableRawPointer?) {
-	guard let calendarWrapper = calendarPtr.map ({ Unmanaged <CPCCalendarWrapper>.fromOpaque ($0).takeUnretainedValue () }) else {
-		return;
+/// Values of a calendar that affect calculations, used to intern calendar wrappers.
+internal struct CPCCalendarFingerprint: Hashable {
+	private let identifier: Calendar.Identifier;
+	private let localeIdentifier: String?;
+	private let timeZoneIdentifier: String;
+	private let firstWeekday: Int;
+	private let minimumDaysInFirstWeek: Int;
+	
+	internal init (_ calendar: Calendar) {
+		self.identifier = calendar.identifier;
+		self.localeIdentifier = calendar.locale?.identifier;
+		self.timeZoneIdentifier = calendar.timeZone.identifier;
+		self.firstWeekday = calendar.firstWeekday;
+		self.minimumDaysInFirstWeek = calendar.minimumDaysInFirstWeek;
 	}
-	calendarWrapper.mainRunLoopWillStartWaiting ();
 }
 
 /* public */ extension Calendar {
@@ -145,32 +239,3 @@ private func CPCCalendarViewMainRunLoopObserver (observer: CFRunLoopObserver!, a
 		return CPCCalendarWrapper.wrap (self);
 	}
 }
-
-/* fileprivate */ extension Unmanaged {
-	fileprivate static func makeRunLoopObserverContext (observer: Instance) -> CFRunLoopObserverContext {
-		return CFRunLoopObserverContext (
-			version: 0,
-			info: self.passUnretained (observer).toOpaque (),
-			retain: { Unmanaged <AnyObject>.retain ($0) },
-			release: { Unmanaged <AnyObject>.release ($0) },
-			copyDescription: { Unmanaged <AnyObject>.copyDescription ($0) }
-		);
-	}
-}
-
-private extension Unmanaged {
-	private static func retain (_ opaque: UnsafeRawPointer?) -> UnsafeRawPointer? {
-		return UnsafeRawPointer (opaque.map { Unmanaged.fromOpaque ($0).retain ().toOpaque () });
-	}
-	
-	private static func release (_ opaque: UnsafeRawPointer?) {
-		opaque.map { Unmanaged.fromOpaque ($0).release () };
-	}
-
-	private static func copyDescription (_ opaque: UnsafeRawPointer?) -> Unmanaged <CFString>? {
-		guard let opaque = opaque, let object = Unmanaged.fromOpaque (opaque).takeUnretainedValue () as? CustomStringConvertible else {
-			return nil;
-		}
-		return Unmanaged <CFString>.passRetained (object.description as CFString);
-	}
-}
@@ -0,0 +1,215 @@
+//
+//  CPCCalendarUnitsReprojection.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// Converts days, months and ranges of days of one calendar to another one in bulk.
+///
+/// Every day is mapped to its number counted from 1970-01-01, which does not depend on calendar, and the number is mapped
+/// back to a day of the target calendar. Both mappings remember the most recently visited month, so that days of the same
+/// month are converted arithmetically. Other months are looked up using Gregorian arithmetic or calendar metadata tables
+/// when possible and require a single `Foundation` computation otherwise.
+internal struct CPCCalendarUnitsReprojection {
+	/// A month along with numbers of its days.
+	///
+	/// A month that is split by an era change is represented by two spans of different months, and the second one starts with a day other than 1.
+	private struct MonthSpan {
+		fileprivate let month: CPCMonth.BackingStorage;
+		fileprivate let firstDay: Int;
+		fileprivate let firstDayNumber: Int;
+		fileprivate let numberOfDays: Int;
+		
+		fileprivate var dayNumbers: Range <Int> {
+			return self.firstDayNumber ..< self.firstDayNumber + self.numberOfDays;
+		}
+		
+		fileprivate func day (withDayNumber dayNumber: Int) -> CPCDay.BackingStorage {
+			return CPCDay.BackingStorage (era: self.month.era, year: self.month.year, month: self.month.month, day: dayNumber - self.firstDayNumber + self.firstDay);
+		}
+		
+		fileprivate func dayNumber (of day: CPCDay.BackingStorage) -> Int {
+			return self.firstDayNumber + day.day - self.firstDay;
+		}
+	}
+	
+	/// Calendar that converted units belong to.
+	internal let source: CPCCalendarWrapper;
+	/// Calendar that units are converted to.
+	internal let target: CPCCalendarWrapper;
+	
+	/// Whether both calendars use the same time zone, so that their day numbers coincide.
+	private let sharesDayNumbers: Bool;
+	private var lastSourceMonth: MonthSpan?;
+	private var lastTargetMonth: MonthSpan?;
+	
+	/// Creates a new conversion between two calendars.
+	///
+	/// - Parameters:
+	///   - source: Calendar that converted units belong to.
+	///   - target: Calendar that units are converted to.
+	internal init (from source: CPCCalendarWrapper, to target: CPCCalendarWrapper) {
+		self.source = source;
+		self.target = target;
+		self.sharesDayNumbers = (source.calendar.timeZone == target.calendar.timeZone);
+	}
+	
+	/// Converts a day to the target calendar.
+	///
+	/// - Parameter day: Day to convert. Days that do not belong to the source calendar are converted using `Foundation`.
+	/// - Returns: Day of the target calendar that contains start of the given day.
+	internal mutating func day (_ day: CPCDay) -> CPCDay {
+		let calendar = day.calendarWrapper;
+		if (calendar === self.target) {
+			return day;
+		}
+		guard (calendar === self.source) else {
+			return CPCDay (containing: day.start, calendar: self.target);
+		}
+		return self.day (withDayNumber: self.targetDayNumber (of: day.backingValue));
+	}
+	
+	/// Converts days to the target calendar.
+	///
+	/// - Parameter days: Days to convert. Conversion is the most efficient when days of the same month are adjacent.
+	/// - Returns: Converted days, in the same order.
+	internal mutating func days <S> (_ days: S) -> [CPCDay] where S: Sequence, S.Element == CPCDay {
+		return days.map { self.day ($0) };
+	}
+	
+	/// Converts a range of days to the target calendar.
+	///
+	/// - Parameter days: Range of days to convert.
+	/// - Returns: Range of days of the target calendar with converted bounds.
+	internal mutating func dayRange (_ days: Range <CPCDay>) -> Range <CPCDay> {
+		return self.day (days.lowerBound) ..< self.day (days.upperBound);
+	}
+	
+	/// Calculates numbers of days of a range of months of the source calendar, counted from 1970-01-01 in the target calendar's time zone.
+	///
+	/// - Parameter months: Months to look up.
+	internal mutating func dayNumbers (of months: Range <CPCMonth>) -> Range <Int> {
+		let source = self.source;
+		return self.targetDayNumber (of: CPCDayBackingStorageIterator.firstDay (of: months.lowerBound.backingValue, calendar: source)) ..<
+			self.targetDayNumber (of: CPCDayBackingStorageIterator.firstDay (of: months.upperBound.backingValue, calendar: source));
+	}
+	
+	/// Returns a day of the target calendar with the given number.
+	///
+	/// - Parameter dayNumber: Number of a day, counted from 1970-01-01.
+	internal mutating func day (withDayNumber dayNumber: Int) -> CPCDay {
+		return CPCDay (backedBy: self.targetMonthSpan (containingDayNumber: dayNumber).day (withDayNumber: dayNumber), calendar: self.target);
+	}
+	
+	/// Returns consecutive months of the target calendar that contain days with the given numbers.
+	///
+	/// - Parameter dayNumbers: Numbers of days, counted from 1970-01-01.
+	internal mutating func months (spanning dayNumbers: Range <Int>) -> [CPCMonth] {
+		var result = [CPCMonth] (), dayNumber = dayNumbers.lowerBound;
+		while (dayNumber < dayNumbers.upperBound) {
+			let monthSpan = self.targetMonthSpan (containingDayNumber: dayNumber);
+			result.append (CPCMonth (backedBy: monthSpan.month, calendar: self.target));
+			dayNumber = monthSpan.dayNumbers.upperBound;
+		}
+		return result;
+	}
+	
+	/// Calculates numbers of days of a range of years, counted from 1970-01-01 in their calendar's time zone.
+	///
+	/// - Parameter years: Years to look up.
+	internal static func dayNumbers (of years: Range <CPCYear>) -> Range <Int> {
+		return self.firstDayNumber (of: years.lowerBound) ..< self.firstDayNumber (of: years.upperBound);
+	}
+	
+	/// Stores relations of consecutive months and their years in calendar units caches.
+	///
+	/// - Parameter months: Consecutive months of the same calendar.
+	internal static func warmCaches (consecutiveMonths months: [CPCMonth]) {
+		guard var previousMonth = months.first else {
+			return;
+		}
+		
+		var year = previousMonth.containingYear, index = guarantee (year.index (of: previousMonth));
+		year.cacheElement (previousMonth, for: index);
+		for month in months.dropFirst () {
+			previousMonth.cacheUnitValue (month, advancedBy: 1);
+			
+			let monthYear = month.containingYear;
+			if (monthYear == year) {
+				index = year.index (after: index);
+			} else {
+				year.cacheUnitValue (monthYear, advancedBy: 1);
+				year = monthYear;
+				index = year.startIndex;
+			}
+			year.cacheElement (month, for: index);
+			previousMonth = month;
+		}
+	}
+}
+
+/* fileprivate */ extension CPCCalendarUnitsReprojection {
+	private static func firstDayNumber (of year: CPCYear) -> Int {
+		return CPCDayBackingStorageIterator.firstDay (of: year [ordinal: 0].backingValue, calendar: year.calendarWrapper).dayNumber (using: year.calendarWrapper);
+	}
+	
+	private static func monthSpan (containingDayNumber dayNumber: Int, calendar: CPCCalendarWrapper) -> MonthSpan {
+		if calendar.isGregorian, let day = CPCDay.BackingStorage (gregorianDayNumber: dayNumber) {
+			let numberOfDays = CPCGregorianArithmetic.numberOfDays (prolepticYear: CPCGregorianArithmetic.prolepticYear (era: day.era, year: day.year), month: day.month);
+			return MonthSpan (month: day.containingMonth (calendar), firstDay: 1, firstDayNumber: dayNumber - day.day + 1, numberOfDays: numberOfDays);
+		}
+		if let month = calendar.metadataTable?.month (containingDayNumber: dayNumber) {
+			let firstDay = CPCDay.BackingStorage (era: month.era, year: month.year, month: month.month, day: month.firstDay);
+			return MonthSpan (month: firstDay.containingMonth (calendar), firstDay: month.firstDay, firstDayNumber: month.firstDayNumber, numberOfDays: month.numberOfDays);
+		}
+		
+		let day = CPCInstrumentation.measure (.calendarCall, calendar: calendar) { CPCDay.BackingStorage (containing: calendar.calendar.startDate (ofDayNumber: dayNumber), calendar: calendar.calendar) };
+		let firstDay = CPCDayBackingStorageIterator.firstDayOfMonth (containing: day, calendar: calendar);
+		let lastDay = CPCDayBackingStorageIterator.lastDayOfMonth (containing: day, calendar: calendar);
+		return MonthSpan (month: day.containingMonth (calendar), firstDay: firstDay, firstDayNumber: dayNumber - day.day + firstDay, numberOfDays: lastDay - firstDay + 1);
+	}
+	
+	private mutating func targetDayNumber (of day: CPCDay.BackingStorage) -> Int {
+		let source = self.source, month = day.containingMonth (source), dayNumber: Int;
+		if let monthSpan = self.lastSourceMonth, monthSpan.month == month {
+			dayNumber = monthSpan.dayNumber (of: day);
+		} else {
+			dayNumber = day.dayNumber (using: source);
+			self.lastSourceMonth = CPCCalendarUnitsReprojection.monthSpan (containingDayNumber: dayNumber, calendar: source);
+		}
+		
+		guard !self.sharesDayNumbers else {
+			return dayNumber;
+		}
+		return self.target.calendar.dayNumber (of: source.calendar.startDate (ofDayNumber: dayNumber));
+	}
+	
+	private mutating func targetMonthSpan (containingDayNumber dayNumber: Int) -> MonthSpan {
+		if let monthSpan = self.lastTargetMonth, monthSpan.dayNumbers ~= dayNumber {
+			return monthSpan;
+		}
+		
+		let monthSpan = CPCCalendarUnitsReprojection.monthSpan (containingDayNumber: dayNumber, calendar: self.target);
+		self.lastTargetMonth = monthSpan;
+		return monthSpan;
+	}
+}
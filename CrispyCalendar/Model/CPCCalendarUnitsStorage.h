@@ -25,8 +25,13 @@
 #define CPCCalendarUnitsStorage_h
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <assert.h>
+#if __has_include (<CoreFoundation/CFBase.h>)
 #include <CoreFoundation/CFBase.h>
+#else
+#include "CPCCoreFoundationCompatibility.h"
+#endif
 
 #pragma pack (push, 1)
 
@@ -258,6 +263,45 @@ int64_t CPCYearBackingStorageGetRawValue (CPCYearBackingStorage storage) {
 	return helper.rawValue;
 }
 				
+/// Packs era, year, month and day values into an integer key which preserves chronological order of represented units.
+/// Leap months are ordered right after regular months with the same number; days of Gregorian-like calendars' first era
+/// (e.g. BC years) are ordered in descending years order if `descendingFirstEraYears` is set.
+CF_INLINE CF_SWIFT_UNAVAILABLE ("Implementation details")
+uint64_t CPCCalendarUnitOrderedKeyMake (intptr_t era, intptr_t year, intptr_t month, intptr_t day, bool descendingFirstEraYears) {
+	if (descendingFirstEraYears && !era) {
+		year = -year;
+	}
+	
+	uint64_t const eraBits = ((uint64_t) (era + (1 << 19))) & 0xFFFFF;
+	uint64_t const yearBits = ((uint64_t) (year + (1 << 27))) & 0xFFFFFFF;
+	uint64_t const monthBits = ((uint64_t) ((month < 0) ? 1 - 2 * month : 2 * month)) & 0xFF;
+	uint64_t const dayBits = ((uint64_t) (day + (1 << 7))) & 0xFF;
+	return (eraBits << 44) | (yearBits << 16) | (monthBits << 8) | dayBits;
+}
+
+CF_INLINE CF_SWIFT_NAME (CPCDayBackingStorage.orderedKey(self:descendingFirstEraYears:))
+uint64_t CPCDayBackingStorageGetOrderedKey (CPCDayBackingStorage storage, bool descendingFirstEraYears) {
+	return CPCCalendarUnitOrderedKeyMake (storage.era, storage.year, storage.month, storage.day, descendingFirstEraYears);
+}
+
+CF_INLINE CF_SWIFT_NAME (CPCMonthBackingStorage.orderedKey(self:descendingFirstEraYears:))
+uint64_t CPCMonthBackingStorageGetOrderedKey (CPCMonthBackingStorage storage, bool descendingFirstEraYears) {
+#if __LP64__
+	return CPCCalendarUnitOrderedKeyMake (storage.era, storage.year, storage.month, 0, descendingFirstEraYears);
+#else
+	return CPCCalendarUnitOrderedKeyMake (CPCMonthBackingStorageGetEra (storage), CPCMonthBackingStorageGetYear (storage), CPCMonthBackingStorageGetMonth (storage), 0, descendingFirstEraYears);
+#endif
+}
+
+CF_INLINE CF_SWIFT_NAME (CPCYearBackingStorage.orderedKey(self:descendingFirstEraYears:))
+uint64_t CPCYearBackingStorageGetOrderedKey (CPCYearBackingStorage storage, bool descendingFirstEraYears) {
+#if __LP64__
+	return CPCCalendarUnitOrderedKeyMake (storage.era, storage.year, 0, 0, descendingFirstEraYears);
+#else
+	return CPCCalendarUnitOrderedKeyMake (CPCYearBackingStorageGetEra (storage), CPCYearBackingStorageGetYear (storage), 0, 0, descendingFirstEraYears);
+#endif
+}
+
 static_assert (sizeof (CPCDayBackingStorage) == sizeof (uint64_t), "Invalid sizeof (CPCDayBackingStorage)");
 static_assert (sizeof (CPCMonthBackingStorage) == sizeof (intptr_t), "Invalid sizeof (CPCMonthBackingStorage)");
 static_assert (sizeof (CPCYearBackingStorage) == sizeof (intptr_t), "Invalid sizeof (CPCYearBackingStorage)");
@@ -38,6 +38,91 @@ internal struct CPCCompoundCalendarUnitIndex: Comparable, Hashable {
 	}
 }
 
+/// Immutable list of subunits' component values of a compound unit, shared by all compound units of the same shape.
+@usableFromInline
+internal final class CPCCompoundCalendarUnitIndices {
+	/// Component values of subunits, ordered by subunits' start dates.
+	@usableFromInline
+	internal let componentValues: ContiguousArray <Int>;
+	
+	/// Number of subunits.
+	@usableFromInline
+	internal var count: Int {
+		return self.componentValues.count;
+	}
+	
+	private let minimumComponentValue: Int;
+	private let ordinals: ContiguousArray <Int>;
+	
+	fileprivate init (_ componentValues: ContiguousArray <Int>) {
+		self.componentValues = componentValues;
+		guard let minimumComponentValue = componentValues.min (), let maximumComponentValue = componentValues.max () else {
+			self.minimumComponentValue = 0;
+			self.ordinals = [];
+			return;
+		}
+		
+		var ordinals = ContiguousArray (repeating: -1, count: maximumComponentValue - minimumComponentValue + 1);
+		for (ordinal, componentValue) in componentValues.enumerated ().reversed () {
+			ordinals [componentValue - minimumComponentValue] = ordinal;
+		}
+		self.minimumComponentValue = minimumComponentValue;
+		self.ordinals = ordinals;
+	}
+	
+	/// Get zero-based position of a subunit with given component value.
+	///
+	/// - Parameter componentValue: Component value of a subunit.
+	/// - Returns: Position of the earliest subunit with such component value or nil if no such subunit exists.
+	@usableFromInline
+	internal func ordinal (forComponentValue componentValue: Int) -> Int? {
+		let offset = componentValue - self.minimumComponentValue;
+		guard self.ordinals.indices ~= offset else {
+			return nil;
+		}
+		let result = self.ordinals [offset];
+		return (result < 0) ? nil : result;
+	}
+}
+
+/// Per-calendar table of interned compound units indices.
+internal struct CPCCompoundCalendarUnitIndicesTable {
+	fileprivate var internedIndices = [ContiguousArray <Int>: CPCCompoundCalendarUnitIndices] ();
+	fileprivate var weekIndices: CPCCompoundCalendarUnitIndices?;
+}
+
+/* internal */ extension CPCCalendarWrapper {
+	/// Returns an interned instance of compound unit indices that contains given component values.
+	///
+	/// - Parameter componentValues: Component values of subunits.
+	internal func internedIndices (_ componentValues: ContiguousArray <Int>) -> CPCCompoundCalendarUnitIndices {
+		if let existingIndices = self.unitIndicesTable.withStoredValue ({ $0.internedIndices [componentValues] }) {
+			return existingIndices;
+		}
+		
+		return self.unitIndicesTable.withMutableStoredValue {
+			if let existingIndices = $0.internedIndices [componentValues] {
+				return existingIndices;
+			}
+			
+			let result = CPCCompoundCalendarUnitIndices (componentValues);
+			$0.internedIndices [componentValues] = result;
+			return result;
+		};
+	}
+	
+	/// Returns an interned instance of indices that is shared by all weeks of this calendar.
+	internal func internedWeekIndices () -> CPCCompoundCalendarUnitIndices {
+		if let existingIndices = self.unitIndicesTable.withStoredValue ({ $0.weekIndices }) {
+			return existingIndices;
+		}
+		
+		let result = self.internedIndices (ContiguousArray (guarantee (self.calendar.maximumRange (of: .weekday))));
+		self.unitIndicesTable.withMutableStoredValue { $0.weekIndices = result };
+		return result;
+	}
+}
+
 /// Protocol, implementing a collection of smaller units that are contained in this calendar unit.
 internal protocol CPCCompoundCalendarUnit: CPCCalendarUnit, BidirectionalCollection where Element: CPCCalendarUnit, Index == CPCCompoundCalendarUnitIndex {
 	/// Calculate all possible indices for a given compound unit.
@@ -45,10 +130,10 @@ internal protocol CPCCompoundCalendarUnit: CPCCalendarUnit, BidirectionalCollect
 	/// - Parameters:
 	///   - value: Backing value of a compound unit to perform calculations for.
 	///   - calendar: Calendar to perform calculations with.
-	/// - Returns: All indices that are valid for compound unit that contains a date represented by given `value`.
-	static func indices (for value: BackingType, using calendar: Calendar) -> ContiguousArray <Int>;
+	/// - Returns: Interned indices that are valid for compound unit that contains a date represented by given `value`.
+	static func indices (for value: BackingType, using calendar: CPCCalendarWrapper) -> CPCCompoundCalendarUnitIndices;
 	
-	var indicesCache: ContiguousArray <Int> { get }
+	var indicesCache: CPCCompoundCalendarUnitIndices { get }
 	
 	func index (of element: Element) -> Index?;
 	func componentValue (of element: Element) -> Int;
@@ -62,12 +147,12 @@ extension CPCCompoundCalendarUnit {
 	
 	@inlinable
 	public var startIndex: Index {
-		return Index (ordinal: self.indicesCache.startIndex);
+		return Index (ordinal: 0);
 	}
 	
 	@inlinable
 	public var endIndex: Index {
-		return Index (ordinal: self.indicesCache.endIndex);
+		return Index (ordinal: self.indicesCache.count);
 	}
 	
 	@inlinable
@@ -107,7 +192,7 @@ extension CPCCompoundCalendarUnit {
 	
 	@usableFromInline
 	internal func index (of element: Element) -> Index? {
-		return self.indicesCache.ordinalValue (forCompoundCalendarUnitComponentValue: self.componentValue (of: element)).map (self.index);
+		return self.indicesCache.ordinal (forComponentValue: self.componentValue (of: element)).map (self.index);
 	}
 
 	@inline (never)
@@ -116,8 +201,8 @@ extension CPCCompoundCalendarUnit {
 			return cachedResult;
 		}
 		
-		let calendar = self.calendar, firstElementBacking = Element.BackingType (containing: self.start, calendar: calendar);
-		let result = Element (backedBy: firstElementBacking.advanced (by: position.ordinalValue, using: calendar), calendar: self.calendarWrapper);
+		let calendar = self.calendarWrapper, firstElementBacking = Element.BackingType (containing: self.start, calendar: calendar.calendar);
+		let result = Element (backedBy: firstElementBacking.advanced (by: position.ordinalValue, using: calendar), calendar: calendar);
 		self.cacheElement (result, for: position)
 		return result;
 	}
@@ -130,20 +215,3 @@ extension CPCCompoundCalendarUnit {
 		return self [Index (ordinal: position)];
 	}
 }
-
-/* internal */ extension ContiguousArray where Element == Int {
-	@usableFromInline
-	internal func ordinalValue (forCompoundCalendarUnitComponentValue componentValue: Int) -> Int? {
-		let expected = componentValue - self [0];
-		if ((self.indices ~= expected) && (self [expected] == componentValue)) {
-			return expected;
-		}
-		if let result = stride (from: expected + 1, to: self.endIndex, by: 1).first (where: { self [$0] == componentValue }) {
-			return result;
-		}
-		if let result = stride (from: expected - 1, through: self.startIndex, by: -11).first (where: { self [$0] == componentValue }) {
-			return result;
-		}
-		return nil;
-	}
-}
@@ -78,7 +78,7 @@ extension CPCDay: CPCCalendarUnit {
 	
 	/// Week number of represented day.
 	public var week: Int {
-		return self.calendar.component (.weekOfYear, from: self.start);
+		return self.calendarWrapper.weekOfYear (ofDayNumber: self.backingValue.dayNumber (using: self.calendarWrapper));
 	}
 	
 	/// This day's number.
@@ -98,7 +98,8 @@ extension CPCDay: CPCCalendarUnit {
 	
 	/// Week that contains represented day.
 	public var containingWeek: CPCWeek {
-		return CPCWeek (containing: self.start, calendarOf: self);
+		let calendar = self.calendarWrapper;
+		return CPCWeek (backedBy: CPCWeek.BackingStorage (containingDayNumber: self.backingValue.dayNumber (using: calendar), calendar: calendar), calendar: calendar);
 	}
 	
 	/// Value that represents a current day in the specified calendar.
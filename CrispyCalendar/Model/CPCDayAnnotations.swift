@@ -0,0 +1,239 @@
+//
+//  CPCDayAnnotations.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// A collection of values attached to days, e.g. event counts or marker colors.
+///
+/// Annotations are grouped by their containing month. Every month that has at least one annotated day stores a day bitmap
+/// and a dense array of annotations ordered by day, so that looking up an annotation of a day takes constant time,
+/// enumerating annotations of a month takes time proportional to their number and updates touch only affected months.
+///
+/// - Note: All annotated days share a single calendar. Days that belong to a different calendar are converted
+///   to the calendar of the collection when they are annotated or looked up.
+public struct CPCDayAnnotations <Annotation> {
+	internal typealias MonthKey = CPCMonth.BackingStorage;
+	
+	/// Annotations of days of a single month.
+	fileprivate struct Slots {
+		/// Annotated days; bit `n` stands for `n + 1`-th day of the month.
+		fileprivate var bitmap: CPCDaySet.Bitmap = 0;
+		/// Annotations of days, ordered by day.
+		fileprivate var annotations = ContiguousArray <Annotation> ();
+	}
+	
+	/// Calendar of annotated days.
+	internal private (set) var calendarWrapper: CPCCalendarWrapper?;
+	/// The number of annotated days.
+	public private (set) var count: Int;
+
+	private var slots: [MonthKey: Slots];
+	
+	/// Creates an empty collection of annotations.
+	public init () {
+		self.calendarWrapper = nil;
+		self.slots = [:];
+		self.count = 0;
+	}
+	
+	/// Creates a collection of annotations from a sequence of annotated days. Later annotations of same days replace earlier ones.
+	///
+	/// - Parameter annotations: Days and their annotations.
+	public init <S> (_ annotations: S) where S: Sequence, S.Element == (CPCDay, Annotation) {
+		self.init ();
+		self.update (annotations.lazy.map { ($0.0, Optional ($0.1)) });
+	}
+	
+	/// A Boolean value that indicates whether there are no annotated days.
+	public var isEmpty: Bool {
+		return self.count == 0;
+	}
+	
+	/// Set of all annotated days.
+	public var days: CPCDaySet {
+		guard let calendar = self.calendarWrapper else {
+			return CPCDaySet ();
+		}
+		return CPCDaySet (calendarWrapper: calendar, monthBitmaps: self.slots.mapValues { $0.bitmap });
+	}
+	
+	/// Accesses annotation of a day. Assigning `nil` removes day's annotation.
+	///
+	/// - Parameter day: Day to look up.
+	public subscript (day: CPCDay) -> Annotation? {
+		get {
+			guard let calendar = self.calendarWrapper else {
+				return nil;
+			}
+			let location = CPCDayAnnotations.location (of: self.converted (day, to: calendar));
+			guard let slots = self.slots [location.month], (slots.bitmap & location.mask) != 0 else {
+				return nil;
+			}
+			return slots.annotations [(slots.bitmap & (location.mask - 1)).nonzeroBitCount];
+		}
+		set {
+			self.update (CollectionOfOne ((day, newValue)));
+		}
+	}
+	
+	/// Check whether a day is annotated.
+	///
+	/// - Parameter day: Day to look up.
+	/// - Returns: `true` if the given day has an annotation; otherwise, `false`.
+	public func contains (_ day: CPCDay) -> Bool {
+		return self [day] != nil;
+	}
+	
+	/// Returns annotated days of a month along with their annotations.
+	///
+	/// - Parameter month: Month to look up.
+	/// - Returns: Annotated days of the month in chronological order.
+	public func annotations (of month: CPCMonth) -> [(day: CPCDay, annotation: Annotation)] {
+		guard let calendar = self.calendarWrapper else {
+			return [];
+		}
+		let month = (month.calendarWrapper === calendar) ? month : CPCMonth (containing: month.start, calendar: calendar);
+		guard let slots = self.slots [month.backingValue] else {
+			return [];
+		}
+		
+		var result = [(day: CPCDay, annotation: Annotation)] ();
+		result.reserveCapacity (slots.annotations.count);
+		var remainingDays = slots.bitmap;
+		for annotation in slots.annotations {
+			let dayIndex = remainingDays.trailingZeroBitCount;
+			result.append ((day: self.day (in: month.backingValue, at: dayIndex), annotation: annotation));
+			remainingDays &= remainingDays - 1;
+		}
+		return result;
+	}
+	
+	/// Returns annotated days of multiple months, e.g. the visible ones, along with their annotations.
+	///
+	/// - Parameter months: Months to look up.
+	/// - Returns: Annotated days of the months; days of every month are in chronological order.
+	public func annotations <S> (of months: S) -> [(day: CPCDay, annotation: Annotation)] where S: Sequence, S.Element == CPCMonth {
+		return months.flatMap { self.annotations (of: $0) };
+	}
+	
+	/// Annotates or removes annotations of multiple days at once.
+	///
+	/// - Parameter changes: Days and their new annotations; `nil` removes day's annotation.
+	/// - Returns: Months whose annotations were changed and which should be redrawn.
+	@discardableResult
+	public mutating func update <S> (_ changes: S) -> Set <CPCMonth> where S: Sequence, S.Element == (CPCDay, Annotation?) {
+		return self.update (changes, isUnchanged: { _, _ in false });
+	}
+}
+
+/* public */ extension CPCDayAnnotations where Annotation: Equatable {
+	/// Annotates or removes annotations of multiple days at once.
+	///
+	/// - Parameter changes: Days and their new annotations; `nil` removes day's annotation.
+	/// - Returns: Months whose annotations were changed and which should be redrawn. Assignments of annotations
+	///   that are equal to the current ones do not count as changes.
+	@discardableResult
+	public mutating func update <S> (_ changes: S) -> Set <CPCMonth> where S: Sequence, S.Element == (CPCDay, Annotation?) {
+		return self.update (changes, isUnchanged: ==);
+	}
+}
+
+/* internal */ extension CPCDayAnnotations {
+	/// Returns bitmap of annotated days of a month.
+	///
+	/// - Parameter month: Month to look up.
+	/// - Returns: Day bitmap of the month; bit `n` stands for `n + 1`-th day of the month.
+	internal func bitmap (of month: CPCMonth) -> CPCDaySet.Bitmap {
+		guard let calendar = self.calendarWrapper else {
+			return 0;
+		}
+		guard calendar === month.calendarWrapper else {
+			return self.days.bitmap (of: month);
+		}
+		return self.slots [month.backingValue]?.bitmap ?? 0;
+	}
+}
+
+/* fileprivate */ extension CPCDayAnnotations {
+	private static func location (of day: CPCDay) -> (month: MonthKey, mask: CPCDaySet.Bitmap) {
+		let backingValue = day.backingValue, dayIndex = backingValue.day - 1;
+		precondition ((0 ..< CPCDaySet.Bitmap.bitWidth) ~= dayIndex, "Day \(backingValue) cannot be represented by a day bitmap");
+		return (backingValue.containingMonth (day.calendarWrapper), 1 << dayIndex);
+	}
+	
+	private func day (in month: MonthKey, at dayIndex: Int) -> CPCDay {
+		let backingValue = CPCDay.BackingStorage (era: month.era, year: month.year, month: month.month, day: dayIndex + 1);
+		return CPCDay (backedBy: backingValue, calendar: guarantee (self.calendarWrapper));
+	}
+	
+	private func converted (_ day: CPCDay, to calendar: CPCCalendarWrapper) -> CPCDay {
+		return (day.calendarWrapper === calendar) ? day : CPCDay (containing: day.start, calendar: calendar);
+	}
+	
+	private mutating func update <S> (_ changes: S, isUnchanged: (Annotation, Annotation) -> Bool) -> Set <CPCMonth> where S: Sequence, S.Element == (CPCDay, Annotation?) {
+		var changedMonths = Set <MonthKey> ();
+		for (day, annotation) in changes {
+			let calendar: CPCCalendarWrapper;
+			if let currentCalendar = self.calendarWrapper {
+				calendar = currentCalendar;
+			} else if (annotation != nil) {
+				calendar = day.calendarWrapper;
+				self.calendarWrapper = calendar;
+			} else {
+				continue;
+			}
+			
+			let location = CPCDayAnnotations.location (of: self.converted (day, to: calendar));
+			var slots = self.slots [location.month] ?? Slots ();
+			let isAnnotated = (slots.bitmap & location.mask) != 0, index = (slots.bitmap & (location.mask - 1)).nonzeroBitCount;
+			switch (annotation, isAnnotated) {
+			case (nil, false):
+				continue;
+			case (nil, true):
+				slots.bitmap &= ~location.mask;
+				slots.annotations.remove (at: index);
+				self.count -= 1;
+			case (.some (let annotation), false):
+				slots.bitmap |= location.mask;
+				slots.annotations.insert (annotation, at: index);
+				self.count += 1;
+			case (.some (let annotation), true):
+				if isUnchanged (slots.annotations [index], annotation) {
+					continue;
+				}
+				slots.annotations [index] = annotation;
+			}
+			
+			self.slots [location.month] = ((slots.bitmap == 0) ? nil : slots);
+			changedMonths.insert (location.month);
+		}
+		
+		guard let calendar = self.calendarWrapper else {
+			return [];
+		}
+		if (self.slots.isEmpty) {
+			self.calendarWrapper = nil;
+		}
+		return Set (changedMonths.map { CPCMonth (backedBy: $0, calendar: calendar) });
+	}
+}
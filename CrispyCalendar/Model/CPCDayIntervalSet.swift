@@ -0,0 +1,419 @@
+//
+//  CPCDayIntervalSet.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// A set of days that is stored as a sorted list of disjoint, non-adjacent half-open ranges of days.
+///
+/// Ranges are stored as chronologically ordered keys of their bounds, so membership checks and lookups of ranges
+/// that intersect a month take logarithmic time, and set algebra operations are performed in a single linear pass.
+/// Sets may be unbounded from either side, e.g. contain all days starting from some date.
+///
+/// - Note: All ranges of a set share a single calendar. Days and sets that belong to a different calendar are converted
+///   to the calendar of the set.
+public struct CPCDayIntervalSet {
+	private typealias Key = UInt64;
+	
+	/// Key that precedes keys of all days; serves as lower bound of sets that are unbounded below.
+	private static let minimumKey = Key.min;
+	/// Key that follows keys of all days; serves as upper bound of sets that are unbounded above.
+	private static let maximumKey = Key.max;
+	
+	/// Calendar of bounds of contained ranges; `nil` if set has no finite bounds.
+	internal private (set) var calendarWrapper: CPCCalendarWrapper?;
+	/// Strictly increasing bounds of ranges; lower (inclusive) bounds are at even positions, upper (exclusive) ones are at odd positions.
+	private var bounds: ContiguousArray <Key>;
+	
+	/// A set containing all days.
+	public static var all: CPCDayIntervalSet {
+		return CPCDayIntervalSet (calendarWrapper: nil, bounds: [CPCDayIntervalSet.minimumKey, CPCDayIntervalSet.maximumKey]);
+	}
+	
+	/// Creates an empty set of days.
+	public init () {
+		self.init (calendarWrapper: nil, bounds: []);
+	}
+	
+	/// Creates a set containing a range of days.
+	///
+	/// - Parameter days: Range of days.
+	public init (_ days: Range <CPCDay>) {
+		let calendar = days.lowerBound.calendarWrapper;
+		self.init (calendarWrapper: calendar, lowerBound: days.lowerBound, upperBound: days.upperBound);
+	}
+	
+	/// Creates a set containing a range of days.
+	///
+	/// - Parameter days: Range of days.
+	public init (_ days: ClosedRange <CPCDay>) {
+		let calendar = days.lowerBound.calendarWrapper;
+		self.init (calendarWrapper: calendar, lowerBound: days.lowerBound, upperBound: days.upperBound.advanced (by: 1));
+	}
+	
+	/// Creates a set containing all days starting from a specific one.
+	///
+	/// - Parameter days: Range of days.
+	public init (_ days: PartialRangeFrom <CPCDay>) {
+		self.init (calendarWrapper: days.lowerBound.calendarWrapper, lowerBound: days.lowerBound, upperBound: nil);
+	}
+	
+	/// Creates a set containing all days preceding a specific one.
+	///
+	/// - Parameter days: Range of days.
+	public init (_ days: PartialRangeUpTo <CPCDay>) {
+		self.init (calendarWrapper: days.upperBound.calendarWrapper, lowerBound: nil, upperBound: days.upperBound);
+	}
+	
+	/// Creates a set containing all days up to a specific one, inclusive.
+	///
+	/// - Parameter days: Range of days.
+	public init (_ days: PartialRangeThrough <CPCDay>) {
+		self.init (calendarWrapper: days.upperBound.calendarWrapper, lowerBound: nil, upperBound: days.upperBound.advanced (by: 1));
+	}
+	
+	/// Creates a set containing all days that intersect a date interval.
+	///
+	/// - Parameters:
+	///   - dateInterval: Date interval to cover.
+	///   - calendar: Calendar of days.
+	public init <R> (_ dateInterval: R, calendar: Calendar) where R: CPCDateInterval {
+		let calendar = calendar.wrapped ();
+		guard dateInterval.start < dateInterval.end else {
+			self.init (calendarWrapper: calendar, bounds: []);
+			return;
+		}
+		
+		let lowerBound = CPCDay (containing: dateInterval.start, calendar: calendar), lastDay = CPCDay (containing: dateInterval.end, calendar: calendar);
+		self.init (calendarWrapper: calendar, lowerBound: lowerBound, upperBound: (lastDay.start < dateInterval.end) ? lastDay.advanced (by: 1) : lastDay);
+	}
+	
+	/// Creates a set containing union of ranges of days.
+	///
+	/// - Parameter ranges: Ranges of days.
+	public init <S> (_ ranges: S) where S: Sequence, S.Element == Range <CPCDay> {
+		self.init ();
+		for range in ranges {
+			self.formUnion (CPCDayIntervalSet (range));
+		}
+	}
+	
+	private init (calendarWrapper: CPCCalendarWrapper?, bounds: ContiguousArray <Key>) {
+		self.calendarWrapper = calendarWrapper;
+		self.bounds = bounds;
+	}
+	
+	private init (calendarWrapper: CPCCalendarWrapper, lowerBound: CPCDay?, upperBound: CPCDay?) {
+		let lowerKey = lowerBound.map { CPCDayIntervalSet.key (of: $0, calendar: calendarWrapper) } ?? CPCDayIntervalSet.minimumKey;
+		let upperKey = upperBound.map { CPCDayIntervalSet.key (of: $0, calendar: calendarWrapper) } ?? CPCDayIntervalSet.maximumKey;
+		self.init (calendarWrapper: calendarWrapper, bounds: (lowerKey < upperKey) ? [lowerKey, upperKey] : []);
+	}
+}
+
+/* public */ extension CPCDayIntervalSet {
+	/// A Boolean value that indicates whether the set contains no days.
+	public var isEmpty: Bool {
+		return self.bounds.isEmpty;
+	}
+	
+	/// Earliest day of the set or `nil` if the set is empty or unbounded below.
+	public var lowerBound: CPCDay? {
+		guard let key = self.bounds.first, key != CPCDayIntervalSet.minimumKey else {
+			return nil;
+		}
+		return self.day (for: key);
+	}
+	
+	/// The day that follows the latest day of the set or `nil` if the set is empty or unbounded above.
+	public var upperBound: CPCDay? {
+		guard let key = self.bounds.last, key != CPCDayIntervalSet.maximumKey else {
+			return nil;
+		}
+		return self.day (for: key);
+	}
+	
+	/// Check whether a day belongs to this set.
+	///
+	/// - Parameter day: Day to look up.
+	/// - Returns: `true` if the day belongs to one of ranges of this set; otherwise, `false`.
+	public func contains (_ day: CPCDay) -> Bool {
+		guard let calendar = self.calendarWrapper else {
+			return !self.isEmpty;
+		}
+		return self.boundsCount (notAfter: CPCDayIntervalSet.key (of: day, calendar: calendar)) % 2 == 1;
+	}
+	
+	/// Returns ranges of days of this set that intersect a month, clamped to that month.
+	///
+	/// - Parameter month: Month to look up.
+	/// - Returns: Chronologically sorted ranges of days of the month.
+	public func ranges (in month: CPCMonth) -> [Range <CPCDay>] {
+		guard let calendar = self.calendarWrapper ?? (self.isEmpty ? nil : month.calendarWrapper) else {
+			return [];
+		}
+		guard calendar === month.calendarWrapper else {
+			return self.converted (to: month.calendarWrapper).ranges (in: month);
+		}
+		return self.keyRanges (in: month).map { self.day (for: $0.lowerBound, calendar: calendar) ..< self.day (for: $0.upperBound, calendar: calendar) };
+	}
+	
+	/// Returns a new set with the days that are not contained in this set.
+	public var inverted: CPCDayIntervalSet {
+		return CPCDayIntervalSet (calendarWrapper: self.calendarWrapper, bounds: CPCDayIntervalSet.merged (self.bounds, [], using: { !$0 && !$1 }));
+	}
+	
+	/// Returns a new set with the days of both this and the given set.
+	public func union (_ other: CPCDayIntervalSet) -> CPCDayIntervalSet {
+		return self.combined (with: other, using: { $0 || $1 });
+	}
+	
+	/// Returns a new set with the days that are common to this and the given set.
+	public func intersection (_ other: CPCDayIntervalSet) -> CPCDayIntervalSet {
+		return self.combined (with: other, using: { $0 && $1 });
+	}
+	
+	/// Returns a new set with the days of this set that are not contained in the given set.
+	public func subtracting (_ other: CPCDayIntervalSet) -> CPCDayIntervalSet {
+		return self.combined (with: other, using: { $0 && !$1 });
+	}
+	
+	/// Returns a new set with the days that are contained in either this or the given set, but not in both.
+	public func symmetricDifference (_ other: CPCDayIntervalSet) -> CPCDayIntervalSet {
+		return self.combined (with: other, using: { $0 != $1 });
+	}
+	
+	/// Adds the days of the given set to this set.
+	public mutating func formUnion (_ other: CPCDayIntervalSet) {
+		self = self.union (other);
+	}
+	
+	/// Removes the days of this set that are not contained in the given set.
+	public mutating func formIntersection (_ other: CPCDayIntervalSet) {
+		self = self.intersection (other);
+	}
+	
+	/// Removes the days of the given set from this set.
+	public mutating func subtract (_ other: CPCDayIntervalSet) {
+		self = self.subtracting (other);
+	}
+	
+	/// Replaces this set with days that are contained in either this or the given set, but not in both.
+	public mutating func formSymmetricDifference (_ other: CPCDayIntervalSet) {
+		self = self.symmetricDifference (other);
+	}
+}
+
+/* internal */ extension CPCDayIntervalSet {
+	/// Smallest range of days that contains all days of this set, with unbounded sides substituted by very distant days;
+	/// `nil` if this set contains all days.
+	internal var hull: CountableRange <CPCDay>? {
+		guard let calendar = self.calendarWrapper else {
+			guard self.isEmpty else {
+				return nil;
+			}
+			let today = CPCDay.today (using: CPCCalendarWrapper.currentUsed);
+			return today ..< today;
+		}
+		guard let firstKey = self.bounds.first, let lastKey = self.bounds.last else {
+			let today = CPCDay.today (using: calendar);
+			return today ..< today;
+		}
+		
+		let lowerBound = (firstKey == CPCDayIntervalSet.minimumKey) ? CPCDay (containing: .distantPast, calendar: calendar) : self.day (for: firstKey, calendar: calendar);
+		let upperBound = (lastKey == CPCDayIntervalSet.maximumKey) ? CPCDay (containing: .distantFuture, calendar: calendar) : self.day (for: lastKey, calendar: calendar);
+		return lowerBound ..< upperBound;
+	}
+	
+	/// Returns bitmap of days of a month that are contained in this set.
+	///
+	/// - Parameter month: Month to look up.
+	/// - Returns: Day bitmap of the month; bit `n` stands for `n + 1`-th day of the month.
+	internal func dayBitmap (of month: CPCMonth) -> CPCDaySet.Bitmap {
+		guard let calendar = self.calendarWrapper ?? (self.isEmpty ? nil : month.calendarWrapper) else {
+			return 0;
+		}
+		guard calendar === month.calendarWrapper else {
+			return self.converted (to: month.calendarWrapper).dayBitmap (of: month);
+		}
+		
+		// Keys of consecutive days of a month differ by one, but key of the next month's first day does not follow the last one.
+		// A month that starts with an era has no day 1, so ranges are also clamped to its real first day.
+		let firstDay = CPCDayBackingStorageIterator.firstDay (of: month.backingValue, calendar: calendar);
+		let firstDayKey = CPCDayIntervalSet.firstDayKey (of: month.backingValue, calendar: calendar);
+		let dayIndices = (firstDay.day - 1) ..< CPCDayBackingStorageIterator.lastDayOfMonth (containing: firstDay, calendar: calendar);
+		var result: CPCDaySet.Bitmap = 0;
+		for range in self.keyRanges (in: month) {
+			let lowerBound = Swift.max (Int (range.lowerBound - firstDayKey), dayIndices.lowerBound);
+			let upperBound = Swift.min (Int (truncatingIfNeeded: range.upperBound &- firstDayKey), dayIndices.upperBound);
+			guard (lowerBound < upperBound) else {
+				continue;
+			}
+			result |= (CPCDaySet.Bitmap.max >> (CPCDaySet.Bitmap.bitWidth - (upperBound - lowerBound))) << lowerBound;
+		}
+		return result;
+	}
+	
+	/// Returns a set containing the same days, with bounds converted to another calendar.
+	///
+	/// - Parameter calendar: Calendar to convert bounds to.
+	internal func converted (to calendar: CPCCalendarWrapper) -> CPCDayIntervalSet {
+		guard let currentCalendar = self.calendarWrapper, currentCalendar !== calendar else {
+			return CPCDayIntervalSet (calendarWrapper: self.calendarWrapper ?? (self.isEmpty ? nil : calendar), bounds: self.bounds);
+		}
+		
+		var reprojection = CPCCalendarUnitsReprojection (from: currentCalendar, to: calendar);
+		let convertedBounds = ContiguousArray (self.bounds.map { key -> Key in
+			guard (key != CPCDayIntervalSet.minimumKey), (key != CPCDayIntervalSet.maximumKey) else {
+				return key;
+			}
+			return reprojection.day (self.day (for: key, calendar: currentCalendar)).backingValue.orderedKey (using: calendar);
+		});
+		return CPCDayIntervalSet (calendarWrapper: calendar, bounds: CPCDayIntervalSet.merged (convertedBounds, [], using: { $0 || $1 }));
+	}
+}
+
+extension CPCDayIntervalSet: Equatable {
+	public static func == (lhs: CPCDayIntervalSet, rhs: CPCDayIntervalSet) -> Bool {
+		guard lhs.bounds == rhs.bounds else {
+			return false;
+		}
+		let hasFiniteBounds = lhs.bounds.contains { ($0 != CPCDayIntervalSet.minimumKey) && ($0 != CPCDayIntervalSet.maximumKey) };
+		return !hasFiniteBounds || (lhs.calendarWrapper === rhs.calendarWrapper);
+	}
+}
+
+extension CPCDayIntervalSet: CustomStringConvertible, CustomDebugStringConvertible {
+	public var description: String {
+		var rangeDescriptions = [String] ();
+		for index in stride (from: 0, to: self.bounds.count, by: 2) {
+			let lowerKey = self.bounds [index], upperKey = self.bounds [index + 1];
+			let lowerDescription = (lowerKey == CPCDayIntervalSet.minimumKey) ? "-∞" : self.day (for: lowerKey).description;
+			let upperDescription = (upperKey == CPCDayIntervalSet.maximumKey) ? "+∞" : self.day (for: upperKey).description;
+			rangeDescriptions.append ("[\(lowerDescription), \(upperDescription))");
+		}
+		return "{\(rangeDescriptions.joined (separator: ", "))}";
+	}
+	
+	public var debugDescription: String {
+		return "<\(CPCDayIntervalSet.self): \(self.description)>";
+	}
+}
+
+/* fileprivate */ extension CPCDayIntervalSet {
+	private static func key (of day: CPCDay, calendar: CPCCalendarWrapper) -> Key {
+		let day = (day.calendarWrapper === calendar) ? day : CPCDay (containing: day.start, calendar: calendar);
+		return day.backingValue.orderedKey (using: calendar);
+	}
+	
+	private static func firstDayKey (of month: CPCMonth.BackingStorage, calendar: CPCCalendarWrapper) -> Key {
+		return CPCDay.BackingStorage (era: month.era, year: month.year, month: month.month, day: 1).orderedKey (using: calendar);
+	}
+	
+	private func day (for key: Key) -> CPCDay {
+		return self.day (for: key, calendar: guarantee (self.calendarWrapper));
+	}
+	
+	private func day (for key: Key, calendar: CPCCalendarWrapper) -> CPCDay {
+		return CPCDay (backedBy: CPCDay.BackingStorage (orderedKey: key, using: calendar), calendar: calendar);
+	}
+	
+	/// Returns number of bounds that are less than or equal to a key; odd result means that the key is contained in this set.
+	private func boundsCount (notAfter key: Key) -> Int {
+		var lowerBound = 0, upperBound = self.bounds.count;
+		while (lowerBound < upperBound) {
+			let middle = (lowerBound + upperBound) / 2;
+			if (self.bounds [middle] <= key) {
+				lowerBound = middle + 1;
+			} else {
+				upperBound = middle;
+			}
+		}
+		return lowerBound;
+	}
+	
+	/// Returns ranges of day keys of this set that intersect a month of this set's calendar, clamped to that month.
+	private func keyRanges (in month: CPCMonth) -> [Range <Key>] {
+		let calendar = month.calendarWrapper;
+		let monthStart = CPCDayIntervalSet.firstDayKey (of: month.backingValue, calendar: calendar), monthEnd = CPCDayIntervalSet.firstDayKey (of: month.advanced (by: 1).backingValue, calendar: calendar);
+		
+		var result = [Range <Key>] (), index = self.boundsCount (notAfter: monthStart);
+		if (index % 2 == 1) {
+			index -= 1;
+		}
+		while (index < self.bounds.count), (self.bounds [index] < monthEnd) {
+			result.append (Swift.max (self.bounds [index], monthStart) ..< Swift.min (self.bounds [index + 1], monthEnd));
+			index += 2;
+		}
+		return result;
+	}
+	
+	private func combined (with other: CPCDayIntervalSet, using operation: (Bool, Bool) -> Bool) -> CPCDayIntervalSet {
+		guard let calendar = self.calendarWrapper ?? other.calendarWrapper else {
+			return CPCDayIntervalSet (calendarWrapper: nil, bounds: CPCDayIntervalSet.merged (self.bounds, other.bounds, using: operation));
+		}
+		let lhs = self.converted (to: calendar), rhs = other.converted (to: calendar);
+		return CPCDayIntervalSet (calendarWrapper: calendar, bounds: CPCDayIntervalSet.merged (lhs.bounds, rhs.bounds, using: operation));
+	}
+	
+	/// Sweeps bounds of two sets in ascending order and emits bounds of the set that contains days for which `operation` returns `true`.
+	///
+	/// - Parameters:
+	///   - lhs: Bounds of the first set; may contain duplicates.
+	///   - rhs: Bounds of the second set; may contain duplicates.
+	///   - operation: Closure that decides whether a day belongs to the result given its membership in both sets.
+	/// - Returns: Strictly increasing bounds of the resulting set.
+	private static func merged (_ lhs: ContiguousArray <Key>, _ rhs: ContiguousArray <Key>, using operation: (Bool, Bool) -> Bool) -> ContiguousArray <Key> {
+		var result = ContiguousArray <Key> ();
+		result.reserveCapacity (lhs.count + rhs.count + 2);
+		
+		var lhsIndex = lhs.startIndex, rhsIndex = rhs.startIndex, key = self.minimumKey, isIncluded = false;
+		while (key != self.maximumKey) {
+			while (lhsIndex < lhs.endIndex), (lhs [lhsIndex] <= key) {
+				lhsIndex += 1;
+			}
+			while (rhsIndex < rhs.endIndex), (rhs [rhsIndex] <= key) {
+				rhsIndex += 1;
+			}
+			
+			let isKeyIncluded = operation (lhsIndex % 2 == 1, rhsIndex % 2 == 1);
+			if (isKeyIncluded != isIncluded) {
+				result.append (key);
+				isIncluded = isKeyIncluded;
+			}
+			
+			switch (lhsIndex < lhs.endIndex, rhsIndex < rhs.endIndex) {
+			case (true, true):
+				key = Swift.min (lhs [lhsIndex], rhs [rhsIndex]);
+			case (true, false):
+				key = lhs [lhsIndex];
+			case (false, true):
+				key = rhs [rhsIndex];
+			case (false, false):
+				key = self.maximumKey;
+			}
+		}
+		if (isIncluded) {
+			result.append (self.maximumKey);
+		}
+		return result;
+	}
+}
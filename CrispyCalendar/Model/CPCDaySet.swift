@@ -0,0 +1,442 @@
+//
+//  CPCDaySet.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// An unordered collection of unique days that stores its members as per-month day bitmaps.
+///
+/// Days are grouped by their containing month, and every month is represented by a single machine word
+/// whose bits correspond to days of that month. Membership checks, insertions and removals take constant time;
+/// set algebra operations process a whole month at once.
+///
+/// - Note: All days of a set share a single calendar. Days that belong to a different calendar are converted
+///   to the calendar of the set when they are inserted or looked up.
+public struct CPCDaySet {
+	internal typealias MonthKey = CPCMonth.BackingStorage;
+	internal typealias Bitmap = UInt64;
+	
+	/// Calendar of days contained in this set.
+	internal private (set) var calendarWrapper: CPCCalendarWrapper?;
+	/// Day bitmaps of months that contain at least one day of this set; bit `n` stands for `n + 1`-th day of a month.
+	internal private (set) var bitmaps: [MonthKey: Bitmap];
+	/// The number of days in the set.
+	public private (set) var count: Int;
+	
+	/// Creates an empty set of days.
+	public init () {
+		self.init (calendarWrapper: nil, bitmaps: [:], count: 0);
+	}
+	
+	private init (calendarWrapper: CPCCalendarWrapper?, bitmaps: [MonthKey: Bitmap] = [:], count: Int = 0) {
+		self.calendarWrapper = calendarWrapper;
+		self.bitmaps = bitmaps;
+		self.count = count;
+	}
+}
+
+/* internal */ extension CPCDaySet {
+	/// Creates a set of days from per-month day bitmaps.
+	///
+	/// - Parameters:
+	///   - calendarWrapper: Calendar of contained days.
+	///   - monthBitmaps: Day bitmaps of months; bit `n` stands for `n + 1`-th day of a month.
+	internal init (calendarWrapper: CPCCalendarWrapper, monthBitmaps: [MonthKey: Bitmap]) {
+		let bitmaps = monthBitmaps.filter { $0.value != 0 };
+		self.init (calendarWrapper: (bitmaps.isEmpty ? nil : calendarWrapper), bitmaps: bitmaps, count: bitmaps.values.reduce (0) { $0 + $1.nonzeroBitCount });
+	}
+
+	/// Check whether the set contains at least one day of a month.
+	///
+	/// - Parameter month: Month to look up.
+	/// - Returns: `true` if some day of the given month is contained in this set; otherwise, `false`.
+	internal func containsDays (of month: CPCMonth) -> Bool {
+		guard let calendar = self.calendarWrapper, !self.isEmpty else {
+			return false;
+		}
+		guard calendar === month.calendarWrapper else {
+			return self.contains { month.contains ($0) };
+		}
+		return self.bitmaps [month.backingValue] != nil;
+	}
+	
+	/// Returns bitmap of days of a month that are contained in this set.
+	///
+	/// - Parameter month: Month to look up.
+	/// - Returns: Day bitmap of the month; bit `n` stands for `n + 1`-th day of the month.
+	internal func bitmap (of month: CPCMonth) -> Bitmap {
+		guard let calendar = self.calendarWrapper, !self.isEmpty else {
+			return 0;
+		}
+		guard calendar === month.calendarWrapper else {
+			return self.converted (to: month.calendarWrapper).bitmap (of: month);
+		}
+		return self.bitmaps [month.backingValue] ?? 0;
+	}
+	
+	/// Returns a set containing the same days converted to another calendar.
+	///
+	/// - Parameter calendar: Calendar to convert days to.
+	internal func converted (to calendar: CPCCalendarWrapper) -> CPCDaySet {
+		guard let currentCalendar = self.calendarWrapper, currentCalendar !== calendar else {
+			return self;
+		}
+		
+		var reprojection = CPCCalendarUnitsReprojection (from: currentCalendar, to: calendar);
+		return CPCDaySet (reprojection.days (self));
+	}
+}
+
+/* internal */ extension CPCMonth {
+	/// Returns bitmap of days of this month that are contained in a range.
+	///
+	/// - Parameter days: Range of days to look up.
+	/// - Returns: Day bitmap of this month; bit `n` stands for `n + 1`-th day of the month.
+	internal func dayBitmap (covering days: Range <CPCDay>) -> CPCDaySet.Bitmap {
+		let calendar = self.calendarWrapper;
+		guard (days.lowerBound.calendarWrapper === calendar), (days.upperBound.calendarWrapper === calendar) else {
+			return self.dayBitmap (covering: CPCDay (containing: days.lowerBound.start, calendar: calendar) ..< CPCDay (containing: days.upperBound.start, calendar: calendar));
+		}
+		
+		// A month that starts with an era has no day 1, so distances are measured from its real first day.
+		let firstDayValue = CPCDayBackingStorageIterator.firstDay (of: self.backingValue, calendar: calendar), firstDay = CPCDay (backedBy: firstDayValue, calendar: calendar);
+		let daysCount = CPCDayBackingStorageIterator.lastDayOfMonth (containing: firstDayValue, calendar: calendar) - firstDayValue.day + 1;
+		let lowerBound = Swift.max (firstDay.distance (to: days.lowerBound), 0), upperBound = Swift.min (firstDay.distance (to: days.upperBound), daysCount);
+		guard (lowerBound < upperBound) else {
+			return 0;
+		}
+		return (CPCDaySet.Bitmap.max >> (CPCDaySet.Bitmap.bitWidth - (upperBound - lowerBound))) << (lowerBound + firstDayValue.day - 1);
+	}
+}
+
+/* fileprivate */ extension CPCDaySet {
+	private static func location (of day: CPCDay) -> (month: MonthKey, mask: Bitmap) {
+		let backingValue = day.backingValue, dayIndex = backingValue.day - 1;
+		precondition ((0 ..< Bitmap.bitWidth) ~= dayIndex, "Day \(backingValue) cannot be represented by a day bitmap");
+		return (backingValue.containingMonth (day.calendarWrapper), 1 << dayIndex);
+	}
+	
+	private func day (in month: MonthKey, at dayIndex: Int) -> CPCDay {
+		let backingValue = CPCDay.BackingStorage (era: month.era, year: month.year, month: month.month, day: dayIndex + 1);
+		return CPCDay (backedBy: backingValue, calendar: guarantee (self.calendarWrapper));
+	}
+	
+	private func converted (_ day: CPCDay, to calendar: CPCCalendarWrapper) -> CPCDay {
+		return (day.calendarWrapper === calendar) ? day : CPCDay (containing: day.start, calendar: calendar);
+	}
+	
+	private mutating func adopting (_ day: CPCDay) -> CPCDay {
+		guard let calendar = self.calendarWrapper else {
+			self.calendarWrapper = day.calendarWrapper;
+			return day;
+		}
+		return self.converted (day, to: calendar);
+	}
+	
+	private func compatibleBitmaps (of other: CPCDaySet) -> [MonthKey: Bitmap] {
+		guard let calendar = self.calendarWrapper, let otherCalendar = other.calendarWrapper, calendar !== otherCalendar else {
+			return other.bitmaps;
+		}
+		
+		var result = CPCDaySet (calendarWrapper: calendar);
+		for day in other {
+			result.insert (day);
+		}
+		return result.bitmaps;
+	}
+	
+	private mutating func combine (with other: CPCDaySet, using operation: (Bitmap, Bitmap) -> Bitmap) {
+		for (month, otherBitmap) in self.compatibleBitmaps (of: other) {
+			let bitmap = self.bitmaps [month] ?? 0, newBitmap = operation (bitmap, otherBitmap);
+			self.bitmaps [month] = ((newBitmap == 0) ? nil : newBitmap);
+			self.count += newBitmap.nonzeroBitCount - bitmap.nonzeroBitCount;
+		}
+	}
+}
+
+extension CPCDaySet: Collection {
+	/// A position of a day in a set.
+	public struct Index: Comparable {
+		fileprivate let monthIndex: Dictionary <MonthKey, Bitmap>.Index;
+		fileprivate let dayIndex: Int;
+		
+		public static func < (lhs: Index, rhs: Index) -> Bool {
+			return (lhs.monthIndex, lhs.dayIndex) < (rhs.monthIndex, rhs.dayIndex);
+		}
+	}
+	
+	/// An iterator over the days of a set.
+	public struct Iterator: IteratorProtocol {
+		private let daySet: CPCDaySet;
+		private var monthsIterator: Dictionary <MonthKey, Bitmap>.Iterator;
+		private var month: MonthKey?;
+		private var remainingDays: Bitmap;
+		
+		fileprivate init (_ daySet: CPCDaySet) {
+			self.daySet = daySet;
+			self.monthsIterator = daySet.bitmaps.makeIterator ();
+			self.month = nil;
+			self.remainingDays = 0;
+		}
+		
+		public mutating func next () -> CPCDay? {
+			while (self.remainingDays == 0) {
+				guard let monthBitmap = self.monthsIterator.next () else {
+					return nil;
+				}
+				self.month = monthBitmap.key;
+				self.remainingDays = monthBitmap.value;
+			}
+			
+			let dayIndex = self.remainingDays.trailingZeroBitCount;
+			self.remainingDays &= self.remainingDays - 1;
+			return self.daySet.day (in: guarantee (self.month), at: dayIndex);
+		}
+	}
+	
+	public var startIndex: Index {
+		return self.firstIndex (inMonthAt: self.bitmaps.startIndex);
+	}
+	
+	public var endIndex: Index {
+		return Index (monthIndex: self.bitmaps.endIndex, dayIndex: 0);
+	}
+	
+	public var isEmpty: Bool {
+		return (self.count == 0);
+	}
+	
+	public func makeIterator () -> Iterator {
+		return Iterator (self);
+	}
+	
+	public subscript (position: Index) -> CPCDay {
+		return self.day (in: self.bitmaps [position.monthIndex].key, at: position.dayIndex);
+	}
+	
+	public func index (after i: Index) -> Index {
+		let remainingDays = self.bitmaps [i.monthIndex].value & (Bitmap.max << (i.dayIndex + 1));
+		guard (remainingDays == 0) else {
+			return Index (monthIndex: i.monthIndex, dayIndex: remainingDays.trailingZeroBitCount);
+		}
+		return self.firstIndex (inMonthAt: self.bitmaps.index (after: i.monthIndex));
+	}
+	
+	private func firstIndex (inMonthAt monthIndex: Dictionary <MonthKey, Bitmap>.Index) -> Index {
+		guard (monthIndex != self.bitmaps.endIndex) else {
+			return self.endIndex;
+		}
+		return Index (monthIndex: monthIndex, dayIndex: self.bitmaps [monthIndex].value.trailingZeroBitCount);
+	}
+}
+
+extension CPCDaySet: SetAlgebra {
+	public init (arrayLiteral elements: CPCDay...) {
+		self.init ();
+		self.formUnion (elements);
+	}
+	
+	public func contains (_ member: CPCDay) -> Bool {
+		guard let calendar = self.calendarWrapper else {
+			return false;
+		}
+		let location = CPCDaySet.location (of: self.converted (member, to: calendar));
+		return ((self.bitmaps [location.month] ?? 0) & location.mask) != 0;
+	}
+	
+	@discardableResult
+	public mutating func insert (_ newMember: CPCDay) -> (inserted: Bool, memberAfterInsert: CPCDay) {
+		let member = self.adopting (newMember), location = CPCDaySet.location (of: member);
+		let bitmap = self.bitmaps [location.month] ?? 0;
+		guard (bitmap & location.mask) == 0 else {
+			return (false, member);
+		}
+		
+		self.bitmaps [location.month] = bitmap | location.mask;
+		self.count += 1;
+		return (true, member);
+	}
+	
+	@discardableResult
+	public mutating func remove (_ member: CPCDay) -> CPCDay? {
+		guard let calendar = self.calendarWrapper else {
+			return nil;
+		}
+		let member = self.converted (member, to: calendar), location = CPCDaySet.location (of: member);
+		guard let bitmap = self.bitmaps [location.month], (bitmap & location.mask) != 0 else {
+			return nil;
+		}
+		
+		self.bitmaps [location.month] = ((bitmap == location.mask) ? nil : bitmap & ~location.mask);
+		self.count -= 1;
+		return member;
+	}
+	
+	@discardableResult
+	public mutating func update (with newMember: CPCDay) -> CPCDay? {
+		let result = self.insert (newMember);
+		return (result.inserted ? nil : result.memberAfterInsert);
+	}
+	
+	public func union (_ other: CPCDaySet) -> CPCDaySet {
+		var result = self;
+		result.formUnion (other);
+		return result;
+	}
+	
+	public func intersection (_ other: CPCDaySet) -> CPCDaySet {
+		var result = self;
+		result.formIntersection (other);
+		return result;
+	}
+	
+	public func symmetricDifference (_ other: CPCDaySet) -> CPCDaySet {
+		var result = self;
+		result.formSymmetricDifference (other);
+		return result;
+	}
+	
+	public func subtracting (_ other: CPCDaySet) -> CPCDaySet {
+		var result = self;
+		result.subtract (other);
+		return result;
+	}
+	
+	public mutating func formUnion (_ other: CPCDaySet) {
+		guard !self.isEmpty else {
+			return self = other;
+		}
+		self.combine (with: other) { $0 | $1 };
+	}
+	
+	public mutating func formIntersection (_ other: CPCDaySet) {
+		guard !self.isEmpty else {
+			return;
+		}
+		
+		let otherBitmaps = self.compatibleBitmaps (of: other);
+		var bitmaps = [MonthKey: Bitmap] (minimumCapacity: Swift.min (self.bitmaps.count, otherBitmaps.count)), count = 0;
+		for (month, bitmap) in self.bitmaps {
+			let commonBitmap = bitmap & (otherBitmaps [month] ?? 0);
+			if (commonBitmap != 0) {
+				bitmaps [month] = commonBitmap;
+				count += commonBitmap.nonzeroBitCount;
+			}
+		}
+		self.bitmaps = bitmaps;
+		self.count = count;
+	}
+	
+	public mutating func formSymmetricDifference (_ other: CPCDaySet) {
+		guard !self.isEmpty else {
+			return self = other;
+		}
+		self.combine (with: other) { $0 ^ $1 };
+	}
+	
+	public mutating func subtract (_ other: CPCDaySet) {
+		guard !self.isEmpty else {
+			return;
+		}
+		self.combine (with: other) { $0 & ~$1 };
+	}
+}
+
+/* public */ extension CPCDaySet {
+	/// Returns a new set with the days of both this set and a given sequence.
+	///
+	/// - Parameter other: A sequence of days.
+	/// - Returns: A new set with the unique days of this set and `other`.
+	public func union <S> (_ other: S) -> CPCDaySet where S: Sequence, S.Element == CPCDay {
+		var result = self;
+		result.formUnion (other);
+		return result;
+	}
+	
+	/// Returns a new set containing the days of this set that do not occur in a given sequence.
+	///
+	/// - Parameter other: A sequence of days.
+	/// - Returns: A new set with days of this set that are not contained in `other`.
+	public func subtracting <S> (_ other: S) -> CPCDaySet where S: Sequence, S.Element == CPCDay {
+		var result = self;
+		result.subtract (other);
+		return result;
+	}
+	
+	/// Inserts days of a given sequence into this set.
+	///
+	/// - Parameter other: A sequence of days.
+	public mutating func formUnion <S> (_ other: S) where S: Sequence, S.Element == CPCDay {
+		for day in other {
+			self.insert (day);
+		}
+	}
+	
+	/// Removes days of a given sequence from this set.
+	///
+	/// - Parameter other: A sequence of days.
+	public mutating func subtract <S> (_ other: S) where S: Sequence, S.Element == CPCDay {
+		for day in other {
+			self.remove (day);
+		}
+	}
+	
+	/// Returns a new set containing the days of this set that satisfy a given predicate.
+	///
+	/// - Parameter isIncluded: A closure that takes a day as its argument and returns a Boolean value indicating whether the day should be included in the returned set.
+	/// - Returns: A set of the days that `isIncluded` allows.
+	public func filter (_ isIncluded: (CPCDay) throws -> Bool) rethrows -> CPCDaySet {
+		var result = CPCDaySet (calendarWrapper: self.calendarWrapper, bitmaps: self.bitmaps, count: self.count);
+		for day in self {
+			if try !isIncluded (day) {
+				result.remove (day);
+			}
+		}
+		return result;
+	}
+}
+
+extension CPCDaySet: Hashable {
+	public static func == (lhs: CPCDaySet, rhs: CPCDaySet) -> Bool {
+		guard (lhs.count == rhs.count) else {
+			return false;
+		}
+		guard !lhs.isEmpty else {
+			return true;
+		}
+		return (lhs.calendarWrapper === rhs.calendarWrapper) && (lhs.bitmaps == rhs.bitmaps);
+	}
+	
+	public func hash (into hasher: inout Hasher) {
+		hasher.combine (self.bitmaps);
+	}
+}
+
+extension CPCDaySet: CustomStringConvertible, CustomDebugStringConvertible {
+	public var description: String {
+		return "[\(self.map { $0.description }.joined (separator: ", "))]";
+	}
+	
+	public var debugDescription: String {
+		return "CPCDaySet (\(self.map { $0.debugDescription }.joined (separator: ", ")))";
+	}
+}
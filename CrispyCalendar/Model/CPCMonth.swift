@@ -30,7 +30,7 @@ public struct CPCMonth {
 	@usableFromInline
 	internal let backingValue: BackingStorage;
 	@usableFromInline
-	internal let indicesCache: ContiguousArray <Int>;
+	internal let indicesCache: CPCCompoundCalendarUnitIndices;
 }
 
 extension CPCMonth: CPCCalendarUnitBase {
@@ -46,14 +46,49 @@ extension CPCMonth: CPCCompoundCalendarUnit {
 	internal static let representedUnit = Calendar.Component.month;
 	internal static let descriptionDateFormatTemplate = "LLyyyy";
 	
-	internal static func indices (for value: BackingStorage, using calendar: Calendar) -> ContiguousArray <Int> {
-		return ContiguousArray (guarantee (calendar.range (of: Element.representedUnit, in: self.representedUnit, for: value.startDate (using: calendar))));
+	/// Returns week numbers of weeks that contain days of a month.
+	///
+	/// Every week is identified by week of year of its first day, so that the last week of December that contains
+	/// January 1 has number 1 and week numbers of a month are not necessarily contiguous (e.g. `[48, 49, 50, 51, 52, 1]`).
+	/// Gregorian arithmetic, metadata tables and `Foundation` fallback all follow this convention.
+	internal static func indices (for value: BackingStorage, using calendar: CPCCalendarWrapper) -> CPCCompoundCalendarUnitIndices {
+		if calendar.isGregorian, let weekNumbers = self.gregorianWeekNumbers (for: value, using: calendar) {
+			return calendar.internedIndices (weekNumbers);
+		}
+		if let weekNumbers = calendar.metadataTable?.month (value, calendar: calendar)?.weekNumbers {
+			return calendar.internedIndices (weekNumbers);
+		}
+		
+		let calendarValue = calendar.calendar;
+		let firstDayNumber = calendarValue.dayNumber (of: value.calendarStartDate (using: calendar)), lastDayNumber = calendarValue.dayNumber (of: value.calendarEndDate (using: calendar)) - 1;
+		return calendar.internedIndices (self.weekNumbers (firstDayNumber: firstDayNumber, lastDayNumber: lastDayNumber, using: calendar));
+	}
+	
+	/// Returns week numbers of weeks that contain days with given numbers.
+	///
+	/// - Parameters:
+	///   - firstDayNumber: Number of the first day of a month, counted from 1970-01-01.
+	///   - lastDayNumber: Number of the last day of a month, counted from 1970-01-01.
+	///   - calendar: Calendar to perform calculations with.
+	internal static func weekNumbers (firstDayNumber: Int, lastDayNumber: Int, using calendar: CPCCalendarWrapper) -> ContiguousArray <Int> {
+		let firstWeekStart = calendar.firstDayNumberOfWeek (containingDayNumber: firstDayNumber);
+		return ContiguousArray (stride (from: firstWeekStart, through: lastDayNumber, by: CPCCalendarWrapper.daysPerWeek).map { calendar.weekOfYear (ofDayNumber: $0) });
+	}
+
+	private static func gregorianWeekNumbers (for value: BackingStorage, using calendar: CPCCalendarWrapper) -> ContiguousArray <Int>? {
+		guard let firstDayNumber = CPCDay.BackingStorage (era: value.era, year: value.year, month: value.month, day: 1).gregorianDayNumber else {
+			return nil;
+		}
+		
+		let prolepticYear = CPCGregorianArithmetic.prolepticYear (era: value.era, year: value.year);
+		let lastDayNumber = firstDayNumber + CPCGregorianArithmetic.numberOfDays (prolepticYear: prolepticYear, month: value.month) - 1;
+		return self.weekNumbers (firstDayNumber: firstDayNumber, lastDayNumber: lastDayNumber, using: calendar);
 	}
 
 	internal init (backedBy value: BackingStorage, calendar: CalendarWrapper) {
 		self.calendarWrapper = calendar;
 		self.backingValue = value;
-		self.indicesCache = CPCMonth.indices (for: value, using: calendar.calendar);
+		self.indicesCache = CPCMonth.indices (for: value, using: calendar);
 	}
 
 	internal func componentValue (of element: Element) -> Int {
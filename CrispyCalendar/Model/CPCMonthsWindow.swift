@@ -0,0 +1,388 @@
+//
+//  CPCMonthsWindow.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// Sliding window of consecutive months that are addressed by integer item indices.
+///
+/// Missing months are computed in whole years on a bounded background queue, several years at once. Only months
+/// that are close to the most recently displayed item are retained; the rest are evicted a year at a time. Pending
+/// work in the direction opposite to the current scrolling direction is cancelled.
+internal final class CPCMonthsWindow {
+	/// Closure that is called on main queue with item indices of newly stored months.
+	internal typealias UpdateHandler = (_ updatedItems: Range <Int>) -> ();
+	
+	fileprivate enum Direction {
+		case backward;
+		case forward;
+		
+		fileprivate var opposite: Direction {
+			switch (self) {
+			case .backward:
+				return .forward;
+			case .forward:
+				return .backward;
+			}
+		}
+	}
+	
+	fileprivate struct State {
+		fileprivate var months: FloatingBaseArray <CPCMonth>;
+		fileprivate var retainedMonthsCount: Int;
+		fileprivate var lastDisplayedItem: Int;
+		fileprivate var lastDirection: Direction?;
+		fileprivate var operations = [Direction: FetchOperation] ();
+	}
+	
+	/// Default number of months that are retained in both directions around the displayed item.
+	internal static let defaultRetainedMonthsCount = 36;
+	
+	/// Number of years that are computed concurrently by a single fetch step.
+	private static let yearsPerChunk = 4;
+	/// Maximum number of fetches that are running at once.
+	private static let maxConcurrentFetches = 2;
+	
+	/// Number of months that are retained in both directions around the most recently displayed item.
+	internal var retainedMonthsCount: Int {
+		get {
+			return self.state.withStoredValue { $0.retainedMonthsCount };
+		}
+		set {
+			self.state.withMutableStoredValue {
+				$0.retainedMonthsCount = max (newValue, 0);
+				$0.evictMonths ();
+			};
+		}
+	}
+	
+	private var state: UnfairThreadsafeStorage <State>;
+	private let fetchQueue: OperationQueue;
+	
+	/// Creates a window that initially contains months of the previous, given and next years.
+	///
+	/// - Parameters:
+	///   - year: Year containing the item at `referenceItem`.
+	///   - referenceItem: Item index of the first month of `year`.
+	///   - retainedMonthsCount: Number of months that are retained around displayed item.
+	internal convenience init (startingYear year: CPCYear, referenceItem: Int, retainedMonthsCount: Int = CPCMonthsWindow.defaultRetainedMonthsCount) {
+		let prevYear = year.prev, nextYear = year.next;
+		self.init (months: FloatingBaseArray (Array (prevYear) + year + nextYear, baseOffset: referenceItem - prevYear.count), referenceItem: referenceItem, retainedMonthsCount: retainedMonthsCount);
+	}
+	
+	/// Creates a window that contains months of another window converted to a different calendar, along with the previous,
+	/// given and next years.
+	///
+	/// Stored months of the other window are converted in bulk and cached relations of converted months are stored in
+	/// calendar units caches, so that nearby months need not be computed again. Months are not converted if they are too far
+	/// from `year`.
+	///
+	/// - Parameters:
+	///   - window: Window to take months from.
+	///   - year: Year containing the item at `referenceItem`.
+	///   - referenceItem: Item index of the first month of `year`.
+	///   - reprojection: Conversion from the calendar of `window` months to the calendar of `year`.
+	internal convenience init (reprojecting window: CPCMonthsWindow, startingYear year: CPCYear, referenceItem: Int, using reprojection: inout CPCCalendarUnitsReprojection) {
+		let (storedMonths, retainedMonthsCount) = window.state.withStoredValue { state -> (Range <CPCMonth>?, Int) in
+			guard let firstMonth = state.months.first, let lastMonth = state.months.last else {
+				return (nil, state.retainedMonthsCount);
+			}
+			return (firstMonth ..< lastMonth.next, state.retainedMonthsCount);
+		};
+		
+		var dayNumbers = CPCCalendarUnitsReprojection.dayNumbers (of: year.prev ..< year.next.next);
+		if let storedMonths = storedMonths {
+			let storedDayNumbers = reprojection.dayNumbers (of: storedMonths);
+			if (storedDayNumbers.lowerBound <= dayNumbers.upperBound), (dayNumbers.lowerBound <= storedDayNumbers.upperBound) {
+				let firstYear = reprojection.day (withDayNumber: storedDayNumbers.lowerBound).containingYear;
+				let lastYear = reprojection.day (withDayNumber: storedDayNumbers.upperBound - 1).containingYear;
+				let storedYearsDayNumbers = CPCCalendarUnitsReprojection.dayNumbers (of: firstYear ..< lastYear.next);
+				dayNumbers = min (dayNumbers.lowerBound, storedYearsDayNumbers.lowerBound) ..< max (dayNumbers.upperBound, storedYearsDayNumbers.upperBound);
+			}
+		}
+		
+		let months = reprojection.months (spanning: dayNumbers);
+		CPCCalendarUnitsReprojection.warmCaches (consecutiveMonths: months);
+		let baseOffset = referenceItem - guarantee (months.firstIndex (of: year [ordinal: 0]));
+		self.init (months: FloatingBaseArray (months, baseOffset: baseOffset), referenceItem: referenceItem, retainedMonthsCount: retainedMonthsCount);
+	}
+	
+	private init (months: FloatingBaseArray <CPCMonth>, referenceItem: Int, retainedMonthsCount: Int) {
+		self.state = UnfairThreadsafeStorage (State (
+			months: months,
+			retainedMonthsCount: max (retainedMonthsCount, 0),
+			lastDisplayedItem: referenceItem,
+			lastDirection: nil
+		));
+		self.fetchQueue = OperationQueue ();
+		self.fetchQueue.name = "CPCMonthsWindow";
+		self.fetchQueue.qualityOfService = .utility;
+		self.fetchQueue.maxConcurrentOperationCount = CPCMonthsWindow.maxConcurrentFetches;
+	}
+	
+	deinit {
+		self.fetchQueue.cancelAllOperations ();
+	}
+	
+	/// Returns stored month for the given item index, or `nil` if it is not computed yet or was evicted.
+	internal func cachedMonth (at item: Int) -> CPCMonth? {
+		return self.state.withStoredValue { $0.months.indices ~= item ? $0.months [item] : nil };
+	}
+	
+	/// Returns month for the given item index, deriving it from the nearest stored month if needed.
+	internal func month (at item: Int) -> CPCMonth {
+		let (nearestMonth, nearestItem): (CPCMonth, Int) = self.state.withStoredValue {
+			let nearestItem = min (max (item, $0.months.startIndex), $0.months.endIndex - 1);
+			return ($0.months [nearestItem], nearestItem);
+		};
+		return (nearestItem == item) ? nearestMonth : nearestMonth.advanced (by: item - nearestItem);
+	}
+	
+	/// Records that the given item became visible, evicting far months and cancelling stale fetches.
+	internal func noteDisplayedItem (_ item: Int) {
+		self.state.withMutableStoredValue { state in
+			let direction: Direction?;
+			if (item > state.lastDisplayedItem) {
+				direction = .forward;
+			} else if (item < state.lastDisplayedItem) {
+				direction = .backward;
+			} else {
+				direction = state.lastDirection;
+			}
+			state.lastDisplayedItem = item;
+			
+			if let direction = direction, direction != state.lastDirection {
+				state.lastDirection = direction;
+				if let staleOperation = state.operations [direction.opposite], staleOperation.queuePriority != .veryHigh {
+					staleOperation.cancel ();
+					state.operations [direction.opposite] = nil;
+				}
+			}
+			
+			state.recenterIfNeeded (around: item);
+			state.evictMonths ();
+		};
+	}
+	
+	/// Schedules computation of all months between stored ones and the given item.
+	///
+	/// - Parameters:
+	///   - item: Item index that must be covered by stored months.
+	///   - highPriority: Whether the item is visible right now.
+	///   - updateHandler: Closure that is called for each stored batch of months.
+	internal func fetchMonths (upTo item: Int, highPriority: Bool, updateHandler: @escaping UpdateHandler) {
+		var recenteredItems: Range <Int>?;
+		let newOperation: FetchOperation? = self.state.withMutableStoredValue { state in
+			recenteredItems = state.recenterIfNeeded (around: item);
+			
+			let direction: Direction;
+			if (item < state.months.startIndex) {
+				direction = .backward;
+			} else if (item >= state.months.endIndex) {
+				direction = .forward;
+			} else {
+				return nil;
+			}
+			
+			if let operation = state.operations [direction] {
+				operation.update (targetItem: item, highPriority: highPriority, updateHandler: updateHandler);
+				return nil;
+			}
+			
+			let operation = FetchOperation (window: self, direction: direction, targetItem: item, updateHandler: updateHandler);
+			operation.update (targetItem: item, highPriority: highPriority, updateHandler: updateHandler);
+			state.operations [direction] = operation;
+			return operation;
+		};
+		
+		if let recenteredItems = recenteredItems {
+			DispatchQueue.main.async {
+				updateHandler (recenteredItems);
+			};
+		}
+		if let newOperation = newOperation {
+			self.fetchQueue.addOperation (newOperation);
+		}
+	}
+	
+	/// Computes and stores next chunk of years for the operation.
+	///
+	/// - Returns: `true` if the operation has not reached its target yet.
+	fileprivate func performFetchStep (for operation: FetchOperation) -> Bool {
+		guard let fetchAttributes = self.state.withMutableStoredValue ({ state -> (edgeMonth: CPCMonth, targetDistance: Int)? in
+			guard state.operations [operation.direction] === operation, !operation.isCancelled else {
+				return nil;
+			}
+			
+			let targetDistance: Int;
+			switch (operation.direction) {
+			case .backward:
+				targetDistance = state.months.startIndex - operation.targetItem;
+			case .forward:
+				targetDistance = operation.targetItem - state.months.endIndex + 1;
+			}
+			guard (targetDistance > 0), let edgeMonth = (operation.direction == .forward) ? state.months.last : state.months.first else {
+				state.operations [operation.direction] = nil;
+				return nil;
+			}
+			return (edgeMonth: edgeMonth, targetDistance: targetDistance);
+		}) else {
+			return false;
+		}
+		
+		let (edgeMonth, targetDistance) = fetchAttributes, edgeYear = edgeMonth.containingYear, step = (operation.direction == .forward) ? 1 : -1;
+		let yearsCount = min (max (targetDistance / edgeYear.count + 1, 1), CPCMonthsWindow.yearsPerChunk);
+		var years = [[CPCMonth]] (repeating: [], count: yearsCount);
+		years.withUnsafeMutableBufferPointer { years in
+			DispatchQueue.concurrentPerform (iterations: yearsCount) {
+				years [$0] = Array (edgeYear.advanced (by: ($0 + 1) * step));
+			};
+		};
+		
+		return self.state.withMutableStoredValue { state in
+			guard state.operations [operation.direction] === operation, !operation.isCancelled else {
+				return false;
+			}
+			
+			let updatedItems: Range <Int>;
+			switch (operation.direction) {
+			case .backward:
+				guard state.months.first == edgeMonth else {
+					state.operations [operation.direction] = nil;
+					return false;
+				}
+				let months = Array (years.reversed ().joined ());
+				state.months.prepend (contentsOf: months);
+				updatedItems = state.months.startIndex ..< state.months.startIndex + months.count;
+				state.evictMonths (from: .forward);
+			case .forward:
+				guard state.months.last == edgeMonth else {
+					state.operations [operation.direction] = nil;
+					return false;
+				}
+				let months = years.joined (), previousEndIndex = state.months.endIndex;
+				state.months.append (contentsOf: months);
+				updatedItems = previousEndIndex ..< state.months.endIndex;
+				state.evictMonths (from: .backward);
+			}
+			
+			let updateHandler = operation.updateHandler;
+			DispatchQueue.main.async {
+				updateHandler (updatedItems);
+			};
+			return true;
+		};
+	}
+}
+
+/* fileprivate */ extension CPCMonthsWindow {
+	fileprivate final class FetchOperation: Operation {
+		fileprivate let direction: Direction;
+		/// Item that must be reached; guarded by the window state lock.
+		fileprivate private (set) var targetItem: Int;
+		/// Handler of the most recent request; guarded by the window state lock.
+		fileprivate private (set) var updateHandler: UpdateHandler;
+		
+		private weak var window: CPCMonthsWindow?;
+		
+		fileprivate init (window: CPCMonthsWindow, direction: Direction, targetItem: Int, updateHandler: @escaping UpdateHandler) {
+			self.window = window;
+			self.direction = direction;
+			self.targetItem = targetItem;
+			self.updateHandler = updateHandler;
+			super.init ();
+		}
+		
+		fileprivate func update (targetItem: Int, highPriority: Bool, updateHandler: @escaping UpdateHandler) {
+			switch (self.direction) {
+			case .backward:
+				self.targetItem = min (self.targetItem, targetItem);
+			case .forward:
+				self.targetItem = max (self.targetItem, targetItem);
+			}
+			self.updateHandler = updateHandler;
+			if (highPriority) {
+				self.queuePriority = .veryHigh;
+				self.qualityOfService = .userInitiated;
+			}
+		}
+		
+		fileprivate override func main () {
+			while let window = self.window, !self.isCancelled, window.performFetchStep (for: self) {}
+		}
+	}
+}
+
+/* fileprivate */ extension CPCMonthsWindow.State {
+	private var retainedItems: ClosedRange <Int> {
+		return (self.lastDisplayedItem - self.retainedMonthsCount) ... (self.lastDisplayedItem + self.retainedMonthsCount);
+	}
+	
+	/// Replaces stored months with the year containing item if it is too far from all of them.
+	///
+	/// - Returns: Indices of stored months if they were replaced.
+	@discardableResult
+	fileprivate mutating func recenterIfNeeded (around item: Int) -> Range <Int>? {
+		guard ((item < self.months.startIndex - self.retainedMonthsCount) || (item >= self.months.endIndex + self.retainedMonthsCount)) else {
+			return nil;
+		}
+		
+		let nearestItem = min (max (item, self.months.startIndex), self.months.endIndex - 1);
+		let month = self.months [nearestItem].advanced (by: item - nearestItem), year = month.containingYear;
+		let startItem = item - year.distance (from: year.startIndex, to: guarantee (year.index (of: month)));
+		for operation in self.operations.values {
+			operation.cancel ();
+		}
+		self.operations = [:];
+		self.months = FloatingBaseArray (year, baseOffset: startItem);
+		return self.months.indices;
+	}
+	
+	/// Removes whole years that are too far from the most recently displayed item, keeping at least one year.
+	fileprivate mutating func evictMonths (from direction: CPCMonthsWindow.Direction? = nil) {
+		guard !self.months.isEmpty else {
+			return;
+		}
+		
+		let retainedItems = self.retainedItems;
+		var keptItems = self.months.indices;
+		if (direction != .forward) {
+			while (true) {
+				let yearLength = self.months [keptItems.lowerBound].containingYear.count;
+				guard (keptItems.count > yearLength), (keptItems.lowerBound + yearLength <= retainedItems.lowerBound) else {
+					break;
+				}
+				keptItems = (keptItems.lowerBound + yearLength) ..< keptItems.upperBound;
+			}
+		}
+		if (direction != .backward) {
+			while (true) {
+				let yearLength = self.months [keptItems.upperBound - 1].containingYear.count;
+				guard (keptItems.count > yearLength), (keptItems.upperBound - yearLength > retainedItems.upperBound) else {
+					break;
+				}
+				keptItems = keptItems.lowerBound ..< (keptItems.upperBound - yearLength);
+			}
+		}
+		self.months.trim (to: keptItems);
+	}
+}
@@ -27,10 +27,11 @@ import Foundation
 public struct CPCWeek {
 	@usableFromInline
 	internal struct BackingStorage: Hashable {
-		fileprivate let date: Date;
+		/// Number of the first day of represented week, counted from 1970-01-01.
+		internal let firstDayNumber: Int;
 		
-		fileprivate init (_ date: Date) {
-			self.date = date;
+		fileprivate init (firstDayNumber: Int) {
+			self.firstDayNumber = firstDayNumber;
 		}
 	}
 
@@ -39,12 +40,12 @@ public struct CPCWeek {
 	@usableFromInline
 	internal let calendarWrapper: CPCCalendarWrapper;
 	@usableFromInline
-	internal let indicesCache: ContiguousArray <Int>;
+	internal let indicesCache: CPCCompoundCalendarUnitIndices;
 
 	internal init (backedBy value: UnitBackingType, calendar: CalendarWrapper) {
 		self.calendarWrapper = calendar;
 		self.backingValue = value;
-		self.indicesCache = CPCWeek.indices (for: value, using: calendar.calendar);
+		self.indicesCache = CPCWeek.indices (for: value, using: calendar);
 	}
 }
 
@@ -62,8 +63,8 @@ extension CPCWeek: CPCCompoundCalendarUnit {
 	internal static let representedUnit = Calendar.Component.weekOfYear;
 	internal static let descriptionDateFormatTemplate = "wddMMyyyy";
 	
-	internal static func indices (for value: BackingStorage, using calendar: Calendar) -> ContiguousArray <Int> {
-		return ContiguousArray (guarantee (calendar.range (of: .weekday, in: self.representedUnit, for: value.date)));
+	internal static func indices (for value: BackingStorage, using calendar: CPCCalendarWrapper) -> CPCCompoundCalendarUnitIndices {
+		return calendar.internedWeekIndices ();
 	}
 
 	internal func componentValue (of element: Element) -> Int {
@@ -74,24 +75,33 @@ extension CPCWeek: CPCCompoundCalendarUnit {
 extension CPCWeek.BackingStorage: CPCCalendarUnitBackingType {
 	internal typealias BackedType = CPCWeek;
 	
+	/// Creates a new storage for a week that contains a specific day.
+	///
+	/// - Parameters:
+	///   - dayNumber: Number of a day, counted from 1970-01-01.
+	///   - calendar: Calendar to perform calculations with.
+	internal init (containingDayNumber dayNumber: Int, calendar: CPCCalendarWrapper) {
+		self.init (firstDayNumber: calendar.firstDayNumberOfWeek (containingDayNumber: dayNumber));
+	}
+	
 	internal init (containing date: Date, calendar: Calendar) {
-		self.init (guarantee (calendar.dateInterval (of: .weekOfYear, for: date)).start);
+		self.init (firstDayNumber: CPCCalendarWrapper.firstDayNumberOfWeek (containingDayNumber: calendar.dayNumber (of: date), firstWeekday: calendar.firstWeekday));
 	}
 	
 	internal func startDate (using calendar: Calendar) -> Date {
-		return self.date;
+		return calendar.startDate (ofDayNumber: self.firstDayNumber);
 	}
 	
 	internal func distance (to other: CPCWeek.BackingStorage, using calendar: Calendar) -> Int {
-		return guarantee (calendar.dateComponents ([.weekOfYear], from: self.date, to: other.date).value (for: .weekOfYear));
+		return (other.firstDayNumber - self.firstDayNumber) / CPCCalendarWrapper.daysPerWeek;
 	}
 	
 	internal func advanced (by value: Int, using calendar: Calendar) -> CPCWeek.BackingStorage {
-		guard (value != 0) else {
-			return self;
-		}
-
-		return CPCWeek.BackingStorage (guarantee (calendar.date (byAdding: .weekOfYear, value: value, to: self.date)));
+		return CPCWeek.BackingStorage (firstDayNumber: self.firstDayNumber + value * CPCCalendarWrapper.daysPerWeek);
+	}
+	
+	internal func orderedKey (using calendar: CPCCalendarWrapper) -> Int {
+		return self.firstDayNumber;
 	}
 }
 	
@@ -113,7 +123,7 @@ extension CPCWeek.BackingStorage: CPCCalendarUnitBackingType {
 	
 	/// Week number in the year.
 	public var weekNumber: Int {
-		return self.calendar.component (.weekOfYear, from: self.backingValue.date);
+		return self.calendarWrapper.weekOfYear (ofDayNumber: self.backingValue.firstDayNumber);
 	}
 	
 	/// Value that represents a current week in the specified calendar.
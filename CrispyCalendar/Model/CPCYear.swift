@@ -30,23 +30,30 @@ public struct CPCYear {
 	@usableFromInline
 	internal let backingValue: BackingStorage;
 	@usableFromInline
-	internal let indicesCache: ContiguousArray <Int>;
+	internal let indicesCache: CPCCompoundCalendarUnitIndices;
 
-	internal static func indices (for value: BackingStorage, using calendar: Calendar) -> ContiguousArray <Int> {
-		return ContiguousArray (sequence (state: CPCMonth (containing: value.startDate (using: calendar), calendar: calendar)) {
-			guard $0.year == value.year else {
+	internal static func indices (for value: BackingStorage, using calendar: CalendarWrapper) -> CPCCompoundCalendarUnitIndices {
+		if (calendar.isGregorian) {
+			return calendar.internedIndices (ContiguousArray (1 ... 12));
+		}
+		if let months = calendar.metadataTable?.months (of: value, calendar: calendar) {
+			return calendar.internedIndices (months);
+		}
+		
+		return calendar.internedIndices (ContiguousArray (sequence (state: value.calendarStartDate (using: calendar)) { monthStart -> Int? in
+			let month = CPCMonth.BackingStorage (containing: monthStart, calendar: calendar);
+			guard (month.era == value.era) && (month.year == value.year) else {
 				return nil;
 			}
-			let result = $0.month;
-			$0 = $0.advanced (by: 1);
-			return result;
-		});
+			monthStart = CPCInstrumentation.measure (.calendarCall, calendar: calendar) { guarantee (calendar.calendar.date (byAdding: .month, value: 1, to: monthStart)) };
+			return month.month;
+		}));
 	}
 
 	internal init (backedBy value: BackingStorage, calendar: CalendarWrapper) {
 		self.calendarWrapper = calendar;
 		self.backingValue = value;
-		self.indicesCache = CPCYear.indices (for: value, using: calendar.calendar);
+		self.indicesCache = CPCYear.indices (for: value, using: calendar);
 	}
 }
 
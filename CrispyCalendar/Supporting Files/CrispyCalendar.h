@@ -22,6 +22,7 @@
 //
 
 #import <CrispyCalendar/CPCCalendarUnitsStorage.h>
+#import <CrispyCalendar/CPCAtomicOperations.h>
 
 #import <CrispyCalendar/CPCCalendarUnitSymbolStyle.h>
 #import <CrispyCalendar/CPCDayCellState.h>
@@ -0,0 +1,84 @@
+//
+//  CPCAtomicOperations.h
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef CPCAtomicOperations_h
+#define CPCAtomicOperations_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#if __has_include (<CoreFoundation/CFBase.h>)
+#include <CoreFoundation/CFBase.h>
+#else
+#include "CPCCoreFoundationCompatibility.h"
+#endif
+
+/// Atomically reads a flag that may be concurrently set by threads holding a shared lock.
+CF_INLINE CF_REFINED_FOR_SWIFT
+bool CPCAtomicFlagLoad (uint8_t const *flag) {
+	return __atomic_load_n (flag, __ATOMIC_RELAXED) != 0;
+}
+
+/// Atomically writes a flag. Relaxed ordering is sufficient because flags are only hints that never
+/// synchronize other memory accesses.
+CF_INLINE CF_REFINED_FOR_SWIFT
+void CPCAtomicFlagStore (uint8_t *flag, bool value) {
+	__atomic_store_n (flag, value ? 1 : 0, __ATOMIC_RELAXED);
+}
+
+/// Atomically adds a value to a statistics counter. Relaxed ordering is sufficient because counters
+/// are never used to synchronize other memory accesses.
+CF_INLINE CF_REFINED_FOR_SWIFT
+void CPCAtomicCounterAdd (int64_t *counter, int64_t value) {
+	__atomic_fetch_add (counter, value, __ATOMIC_RELAXED);
+}
+
+/// Atomically reads current value of a statistics counter.
+CF_INLINE CF_REFINED_FOR_SWIFT
+int64_t CPCAtomicCounterLoad (int64_t const *counter) {
+	return __atomic_load_n (counter, __ATOMIC_RELAXED);
+}
+
+/// Atomically resets a statistics counter to zero.
+CF_INLINE CF_REFINED_FOR_SWIFT
+void CPCAtomicCounterReset (int64_t *counter) {
+	__atomic_store_n (counter, 0, __ATOMIC_RELAXED);
+}
+
+/// Atomically reads a pointer that may be concurrently published by `CPCAtomicPointerPublish`. Acquire ordering
+/// makes memory written before publication visible to the reading thread.
+CF_INLINE CF_REFINED_FOR_SWIFT
+void *CPCAtomicPointerLoad (void *const *pointer) {
+	return __atomic_load_n (pointer, __ATOMIC_ACQUIRE);
+}
+
+/// Atomically publishes a pointer unless one has been published already.
+///
+/// @return true if the value was published, false if another value had been published before.
+CF_INLINE CF_REFINED_FOR_SWIFT
+bool CPCAtomicPointerPublish (void **pointer, void *value) {
+	void *expected = NULL;
+	return __atomic_compare_exchange_n (pointer, &expected, value, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+}
+
+#endif /* CPCAtomicOperations_h */
@@ -0,0 +1,375 @@
+//
+//  CPCInstrumentation.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+#if SWIFT_PACKAGE
+import CrispyCalendarCore
+#endif
+#if CPC_INSTRUMENTATION && canImport (os)
+import os.signpost
+#endif
+
+/// Counters and latency histograms of work that is performed by the library: `Calendar` calls, calendar units cache
+/// lookups and purges, lock acquisitions and date formatter creations.
+///
+/// Instrumentation is compiled only when `CPC_INSTRUMENTATION` compilation condition is set (e.g. by adding it to
+/// `SWIFT_ACTIVE_COMPILATION_CONDITIONS` of the framework target). Otherwise recording calls are inlined away entirely,
+/// `isEnabled` is `false` and all snapshots are empty. Counters are updated using relaxed atomic operations and
+/// intervals are measured with a monotonic clock, so instrumented builds are suitable for production use.
+public enum CPCInstrumentation {
+	/// Kinds of counted events.
+	public enum Counter: Int, CaseIterable {
+		/// Calculations that are performed by a `Calendar` instance.
+		case calendarCalls;
+		/// Calendar units cache lookups that found a cached value.
+		case cacheHits;
+		/// Calendar units cache lookups that did not find a cached value.
+		case cacheMisses;
+		/// Purges of calendar units caches.
+		case cachePurges;
+		/// Acquisitions of locks that guard internal state; these are not attributed to any calendar.
+		case lockAcquisitions;
+		/// Creations of new date formatters.
+		case formatterCreations;
+	}
+	
+	/// Kinds of measured intervals. Every measured interval is also counted by a corresponding `Counter`.
+	public enum Interval: Int, CaseIterable {
+		/// A single calculation performed by a `Calendar` instance.
+		case calendarCall;
+		/// A purge of calendar units caches.
+		case cachePurge;
+		/// Creation of a date formatter.
+		case formatterCreation;
+	}
+	
+	/// Distribution of measured interval durations.
+	public struct Histogram {
+		/// Number of intervals in every bucket; `n`-th bucket counts durations from 2^n up to 2^(n+1) nanoseconds.
+		public let bucketCounts: [Int];
+		/// Total duration of measured intervals.
+		public let totalDuration: TimeInterval;
+		
+		/// Number of measured intervals.
+		public var count: Int {
+			return self.bucketCounts.reduce (0, +);
+		}
+		
+		/// Average duration of measured intervals.
+		public var averageDuration: TimeInterval {
+			let count = self.count;
+			return (count > 0) ? self.totalDuration / TimeInterval (count) : 0.0;
+		}
+		
+		/// Returns an upper estimate of a duration percentile.
+		///
+		/// - Parameter percentile: Percentile to estimate, from 0 to 1.
+		/// - Returns: Duration that is not exceeded by the given fraction of measured intervals.
+		public func duration (atPercentile percentile: Double) -> TimeInterval {
+			let targetCount = (Double (self.count) * percentile).rounded (.up);
+			var accumulatedCount = 0;
+			for (bucket, bucketCount) in self.bucketCounts.enumerated () where bucketCount > 0 {
+				accumulatedCount += bucketCount;
+				if (Double (accumulatedCount) >= targetCount) {
+					return TimeInterval (UInt64 (1) << (bucket + 1)) / TimeInterval (NSEC_PER_SEC);
+				}
+			}
+			return 0.0;
+		}
+	}
+	
+	/// Values of all counters and histograms at some point in time.
+	public struct Snapshot {
+		/// Values of counters.
+		public let counters: [Counter: Int];
+		/// Histograms of interval durations.
+		public let histograms: [Interval: Histogram];
+		
+		/// Value of a counter.
+		public subscript (counter: Counter) -> Int {
+			return self.counters [counter] ?? 0;
+		}
+		
+		/// Histogram of an interval durations.
+		public subscript (interval: Interval) -> Histogram {
+			return self.histograms [interval] ?? Histogram (bucketCounts: [], totalDuration: 0.0);
+		}
+	}
+	
+	/// Indicates that instrumentation is compiled in.
+	public static var isEnabled: Bool {
+#if CPC_INSTRUMENTATION
+		return true;
+#else
+		return false;
+#endif
+	}
+	
+	/// Controls whether measured intervals are emitted as signposts that appear in Instruments' "Points of Interest".
+	///
+	/// - Note: Signposts are only available on iOS 12 and later and only when instrumentation is compiled in.
+	public static var emitsSignposts = false;
+	
+	/// Returns values of counters that are accumulated for all calendars, including work that is not attributed to any of them.
+	///
+	/// - Returns: Current values of counters and histograms.
+	public static func snapshot () -> Snapshot {
+#if CPC_INSTRUMENTATION
+		let allCounters = self.unattributedCounters + self.calendarCounters.withStoredValue { Array ($0.values) };
+		return CPCInstrumentationCounters.snapshot (of: allCounters);
+#else
+		return Snapshot (counters: [:], histograms: [:]);
+#endif
+	}
+	
+	/// Returns values of counters that are accumulated for a calendar.
+	///
+	/// - Parameter calendar: Calendar to return counters of.
+	/// - Returns: Current values of counters and histograms.
+	public static func snapshot (for calendar: Calendar) -> Snapshot {
+#if CPC_INSTRUMENTATION
+		let fingerprint = CPCCalendarFingerprint (calendar);
+		let counters = self.calendarCounters.withStoredValue { $0 [fingerprint] };
+		return CPCInstrumentationCounters.snapshot (of: counters.map { [$0] } ?? []);
+#else
+		return Snapshot (counters: [:], histograms: [:]);
+#endif
+	}
+	
+	/// Resets all counters and histograms to zero.
+	public static func reset () {
+#if CPC_INSTRUMENTATION
+		self.unattributedCounters.forEach { $0.reset () };
+		self.calendarCounters.withStoredValue { $0.values.forEach { $0.reset () } };
+#endif
+	}
+}
+
+/* internal */ extension CPCInstrumentation {
+	/// Increments a counter.
+	///
+	/// - Parameters:
+	///   - counter: Counter to increment.
+	///   - calendar: Calendar to attribute the event to.
+	@inline (__always)
+	internal static func record (_ counter: Counter, calendar: CPCCalendarWrapper? = nil) {
+#if CPC_INSTRUMENTATION
+		(calendar?.instrumentationCounters ?? self.currentUnattributedCounters).add (1, to: counter);
+#endif
+	}
+	
+	/// Records a cache lookup as either hit or miss.
+	///
+	/// - Parameters:
+	///   - value: Result of the lookup.
+	///   - calendar: Calendar that owns the looked up cache.
+	/// - Returns: `value`.
+	@inline (__always)
+	internal static func recordCacheLookup <T> (_ value: T?, calendar: CPCCalendarWrapper) -> T? {
+#if CPC_INSTRUMENTATION
+		self.record ((value == nil) ? .cacheMisses : .cacheHits, calendar: calendar);
+#endif
+		return value;
+	}
+	
+	/// Measures duration of an interval and counts it.
+	///
+	/// - Parameters:
+	///   - interval: Kind of the measured interval.
+	///   - calendar: Calendar to attribute the interval to.
+	///   - body: Work to measure.
+	/// - Returns: Value returned by `body`.
+	@inline (__always)
+	internal static func measure <T> (_ interval: Interval, calendar: CPCCalendarWrapper? = nil, _ body: () throws -> T) rethrows -> T {
+#if CPC_INSTRUMENTATION
+		let counters = calendar?.instrumentationCounters ?? self.currentUnattributedCounters, signpostID = self.beginSignpost (interval);
+		let startTime = DispatchTime.now ().uptimeNanoseconds;
+		defer {
+			counters.add (interval, duration: DispatchTime.now ().uptimeNanoseconds &- startTime);
+			self.endSignpost (interval, signpostID);
+		}
+#endif
+		return try body ();
+	}
+}
+
+#if CPC_INSTRUMENTATION
+/* internal */ extension CPCInstrumentation {
+	/// Number of stripes of unattributed counters; must be a power of two.
+	private static let unattributedStripesCount = 16;
+	/// Unattributed work (mostly lock traffic) happens on every thread, so it is counted by several independently allocated
+	/// counters that are picked by calling thread instead of contending for a single set of atomics.
+	private static let unattributedCounters = (0 ..< CPCInstrumentation.unattributedStripesCount).map { _ in CPCInstrumentationCounters () };
+	private static var calendarCounters = UnfairThreadsafeStorage ([CPCCalendarFingerprint: CPCInstrumentationCounters] ());
+	
+	/// Returns counters of a calendar, creating them if needed. Counters outlive calendar wrappers, so that
+	/// values are accumulated even if calendars are released and wrapped again later.
+	///
+	/// - Parameter fingerprint: Fingerprint of a calendar.
+	/// - Returns: Counters of calendars with the given fingerprint.
+	internal static func counters (for fingerprint: CPCCalendarFingerprint) -> CPCInstrumentationCounters {
+		return self.calendarCounters.withMutableStoredValue {
+			if let existingCounters = $0 [fingerprint] {
+				return existingCounters;
+			}
+			let counters = CPCInstrumentationCounters ();
+			$0 [fingerprint] = counters;
+			return counters;
+		};
+	}
+}
+
+/* fileprivate */ extension CPCInstrumentation {
+	/// Stripe of unattributed counters that is used by the calling thread.
+	fileprivate static var currentUnattributedCounters: CPCInstrumentationCounters {
+#if canImport (Darwin)
+		let threadID = UInt64 (UInt (bitPattern: pthread_self ()));
+#else
+		let threadID = UInt64 (pthread_self ());
+#endif
+		let stripeIndex = Int (truncatingIfNeeded: (threadID &* 0x9E3779B97F4A7C15) >> 32) & (self.unattributedStripesCount - 1);
+		return self.unattributedCounters [stripeIndex];
+	}
+	
+#if canImport (os)
+	private static let signpostLog = OSLog (subsystem: "ru.cleverpumpkin.CrispyCalendar", category: "PointsOfInterest");
+#endif
+	
+	@inline (__always)
+	fileprivate static func beginSignpost (_ interval: Interval) -> UInt64 {
+#if canImport (os)
+		guard self.emitsSignposts, #available (iOS 12.0, macOS 10.14, tvOS 12.0, watchOS 5.0, *) else {
+			return 0;
+		}
+		let signpostID = OSSignpostID (log: self.signpostLog);
+		os_signpost (.begin, log: self.signpostLog, name: interval.signpostName, signpostID: signpostID);
+		return signpostID.rawValue;
+#else
+		return 0;
+#endif
+	}
+	
+	@inline (__always)
+	fileprivate static func endSignpost (_ interval: Interval, _ signpostID: UInt64) {
+#if canImport (os)
+		guard (signpostID != 0), #available (iOS 12.0, macOS 10.14, tvOS 12.0, watchOS 5.0, *) else {
+			return;
+		}
+		os_signpost (.end, log: self.signpostLog, name: interval.signpostName, signpostID: OSSignpostID (signpostID));
+#endif
+	}
+}
+
+/* fileprivate */ extension CPCInstrumentation.Interval {
+	fileprivate var counter: CPCInstrumentation.Counter {
+		switch (self) {
+		case .calendarCall:
+			return .calendarCalls;
+		case .cachePurge:
+			return .cachePurges;
+		case .formatterCreation:
+			return .formatterCreations;
+		}
+	}
+	
+	fileprivate var signpostName: StaticString {
+		switch (self) {
+		case .calendarCall:
+			return "Calendar call";
+		case .cachePurge:
+			return "Cache purge";
+		case .formatterCreation:
+			return "Formatter creation";
+		}
+	}
+}
+
+/// Atomic counters and duration histograms of a single calendar or of work that is not attributed to any calendar.
+internal final class CPCInstrumentationCounters {
+	private typealias Counter = CPCInstrumentation.Counter;
+	private typealias Interval = CPCInstrumentation.Interval;
+	
+	private static let bucketsCount = 40;
+	/// Every histogram is stored as bucket counts followed by total duration in nanoseconds.
+	private static let histogramSize = CPCInstrumentationCounters.bucketsCount + 1;
+	private static let valuesCount = Counter.allCases.count + Interval.allCases.count * CPCInstrumentationCounters.histogramSize;
+	
+	private let values: UnsafeMutablePointer <Int64>;
+	
+	fileprivate init () {
+		self.values = .allocate (capacity: CPCInstrumentationCounters.valuesCount);
+		self.values.initialize (repeating: 0, count: CPCInstrumentationCounters.valuesCount);
+	}
+	
+	deinit {
+		self.values.deinitialize (count: CPCInstrumentationCounters.valuesCount);
+		self.values.deallocate ();
+	}
+	
+	fileprivate static func snapshot (of counters: [CPCInstrumentationCounters]) -> CPCInstrumentation.Snapshot {
+		var values = [Int64] (repeating: 0, count: self.valuesCount);
+		for counters in counters {
+			for index in values.indices {
+				values [index] += __CPCAtomicCounterLoad (counters.values + index);
+			}
+		}
+		
+		var countersValues = [Counter: Int] (), histograms = [Interval: CPCInstrumentation.Histogram] ();
+		for counter in Counter.allCases {
+			countersValues [counter] = Int (values [counter.rawValue]);
+		}
+		for interval in Interval.allCases {
+			let histogramOffset = self.histogramOffset (of: interval);
+			histograms [interval] = CPCInstrumentation.Histogram (
+				bucketCounts: values [histogramOffset ..< histogramOffset + self.bucketsCount].map { Int ($0) },
+				totalDuration: TimeInterval (values [histogramOffset + self.bucketsCount]) / TimeInterval (NSEC_PER_SEC)
+			);
+		}
+		return CPCInstrumentation.Snapshot (counters: countersValues, histograms: histograms);
+	}
+	
+	private static func histogramOffset (of interval: Interval) -> Int {
+		return Counter.allCases.count + interval.rawValue * self.histogramSize;
+	}
+	
+	@inline (__always)
+	fileprivate func add (_ value: Int, to counter: Counter) {
+		__CPCAtomicCounterAdd (self.values + counter.rawValue, Int64 (value));
+	}
+	
+	@inline (__always)
+	fileprivate func add (_ interval: Interval, duration: UInt64) {
+		let histogramOffset = CPCInstrumentationCounters.histogramOffset (of: interval);
+		let bucket = min (UInt64.bitWidth - 1 - (duration | 1).leadingZeroBitCount, CPCInstrumentationCounters.bucketsCount - 1);
+		self.add (1, to: interval.counter);
+		__CPCAtomicCounterAdd (self.values + histogramOffset + bucket, 1);
+		__CPCAtomicCounterAdd (self.values + histogramOffset + CPCInstrumentationCounters.bucketsCount, Int64 (truncatingIfNeeded: duration));
+	}
+	
+	fileprivate func reset () {
+		for index in 0 ..< CPCInstrumentationCounters.valuesCount {
+			__CPCAtomicCounterReset (self.values + index);
+		}
+	}
+}
+#endif
@@ -0,0 +1,131 @@
+//
+//  DateFormatter_reusing.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/* internal */ extension DateFormatter {
+	/// Approximate number of bytes retained by a single formatter, including its ICU counterpart.
+	///
+	/// This is a flat estimate that is not measured; actual size depends on the locale, calendar and format of a formatter,
+	/// and neither Foundation nor ICU report it. The estimate only has to keep formatters in proportion to units caches:
+	/// a formatter is cached only after it has been dequeued and returned by a view, so their number never exceeds
+	/// the peak number of formatters used at once, which is a few per visible month. Even if the estimate is several times
+	/// too small, formatters stay a small fraction of the default 4 MiB budget, and they are erased first when it is exceeded.
+	private static let estimatedFormatterByteCount = 8192;
+	
+	/// Approximate number of bytes retained by formatters that are available for reuse.
+	internal static var cachedFormattersByteCount: Int {
+		return self.availableFormatters.withStoredValue { $0.values.reduce (0) { $0 + $1.count } } * self.estimatedFormatterByteCount;
+	}
+	
+	internal static func eraseCachedFormatters (calendar: CPCCalendarWrapper) {
+		self.availableFormatters.withMutableStoredValue { $0 = $0.filter { $0.key.calendarWrapper !== calendar } };
+	}
+	
+	internal static func eraseCachedFormatters () {
+		self.availableFormatters.withMutableStoredValue { $0.removeAll () };
+	}
+}
+
+/* internal */ extension DateFormatter {
+	private struct CacheKey: Hashable {
+		fileprivate unowned let calendarWrapper: CPCCalendarWrapper;
+		private let dateFormat: String;
+		
+		fileprivate static func == (lhs: CacheKey, rhs: CacheKey) -> Bool {
+			return (lhs.calendarWrapper === rhs.calendarWrapper) && (lhs.dateFormat == rhs.dateFormat);
+		}
+		
+		fileprivate init (_ calendarWrapper: CPCCalendarWrapper, _ dateFormat: String) {
+			self.calendarWrapper = calendarWrapper;
+			self.dateFormat = dateFormat;
+		}
+		
+#if swift(>=4.2)
+		fileprivate func hash (into hasher: inout Hasher) {
+			hasher.combine (self.calendarWrapper);
+			hasher.combine (self.dateFormat);
+		}
+#else
+		fileprivate var hashValue: Int {
+			return self.calendarWrapper.hashValue &* 13 &+ self.dateFormat.hashValue &* 19;
+		}
+#endif
+	}
+	
+	private static var availableFormatters = UnfairThreadsafeStorage ([CacheKey: [DateFormatter]] ());
+	
+	private static func availableFormatter (for month: CPCMonth, format: String) -> DateFormatter? {
+		return self.availableFormatters.withMutableStoredValue {
+			let cacheKey = CacheKey (month.calendarWrapper, format);
+			guard var available = $0 [cacheKey], !available.isEmpty else {
+				return nil;
+			}
+			let result = available.removeLast ();
+			$0 [cacheKey] = available;
+			return result;
+		};
+	}
+	
+	internal static func dequeueFormatter (for month: CPCMonth, format: String) -> DateFormatter {
+		if let reusedFormatter = self.availableFormatter (for: month, format: format) {
+			return reusedFormatter;
+		}
+		
+		return CPCInstrumentation.measure (.formatterCreation, calendar: month.calendarWrapper) {
+			let dateFormatter = DateFormatter ();
+			dateFormatter.calendar = month.calendar;
+			dateFormatter.locale = month.calendar.locale;
+			dateFormatter.dateFormat = format;
+			dateFormatter.formattingContext = .standalone;
+			return dateFormatter;
+		};
+	}
+
+	internal static func dequeueFormatter (for month: CPCMonth, dateFormatTemplate template: String) -> DateFormatter {
+		return self.dequeueFormatter (for: month, format: DateFormatter.dateFormat (fromTemplate: template, options: 0, locale: month.calendar.locale) ?? template);
+	}
+	
+	internal static func makeReusable (_ formatters: [DateFormatter], wrapper: CPCCalendarWrapper) {
+		DateFormatter.availableFormatters.withMutableStoredValue {
+			for formatter in formatters {
+				formatter.makeReusableUnlocked (&$0, wrapper: wrapper);
+			}
+		};
+	}
+
+	internal func makeReusable (wrapper: CPCCalendarWrapper) {
+		DateFormatter.availableFormatters.withMutableStoredValue {
+			self.makeReusableUnlocked (&$0, wrapper: wrapper);
+		};
+	}
+	
+	private func makeReusableUnlocked (_ cache: inout [CacheKey: [DateFormatter]], wrapper: CPCCalendarWrapper) {
+		let cacheKey = CacheKey (wrapper, self.dateFormat), value = [self];
+		if let formatters = cache [cacheKey] {
+			cache [cacheKey] = formatters + value;
+		} else {
+			cache [cacheKey] = value;
+		}
+	}
+}
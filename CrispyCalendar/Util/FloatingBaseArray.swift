@@ -25,74 +25,109 @@ import Foundation
 
 internal typealias FloatingBaseArraySlice <Element> = Slice <FloatingBaseArray <Element>>;
 
+/// Random-access collection whose indices are not required to start at zero and may shift when elements
+/// are inserted to or removed from its front.
+///
+/// Elements are stored in a growable ring buffer, so prepending, appending and removing elements at either
+/// end take amortized constant time. The buffer is copied on write.
 internal struct FloatingBaseArray <Element> {
-	private var backing: ContiguousArray <Element>;
+	private var buffer: FloatingBaseArrayBuffer <Element>;
 	private var baseOffset: Int;
 }
 
 extension FloatingBaseArray: MutableCollection, RandomAccessCollection {
-	internal typealias Index = ContiguousArray <Element>.Index;
+	internal typealias Index = Int;
 	internal typealias SubSequence = Slice <FloatingBaseArray>;
 	
 	internal var startIndex: Index {
-		return self.backing.startIndex + self.baseOffset;
+		return self.baseOffset;
 	}
 	
 	internal var endIndex: Index {
-		return self.backing.endIndex + self.baseOffset;
+		return self.baseOffset + self.buffer.count;
+	}
+	
+	internal var count: Int {
+		return self.buffer.count;
+	}
+	
+	internal var isEmpty: Bool {
+		return self.buffer.count == 0;
 	}
 	
 	internal func index (after i: Index) -> Index {
-		return self.backing.index (after: i - self.baseOffset) + self.baseOffset;
+		return i + 1;
 	}
 
 	internal func index (before i: Index) -> Index {
-		return self.backing.index (before: i - self.baseOffset) + self.baseOffset;
+		return i - 1;
 	}
 
 	internal subscript (position: Index) -> Element {
-		get { return self.backing [position - self.baseOffset] }
-		set { self.backing [position - self.baseOffset] = newValue }
+		get {
+			precondition (self.indices ~= position, "Index out of range");
+			return self.buffer [position - self.baseOffset];
+		}
+		set {
+			precondition (self.indices ~= position, "Index out of range");
+			self.makeUniqueBuffer (minimumCapacity: self.count);
+			self.buffer [position - self.baseOffset] = newValue;
+		}
 	}
 
 	internal subscript (bounds: Range <Index>) -> Slice <FloatingBaseArray> {
-		get { return Slice (base: self, bounds: bounds) }
-		set { self.backing.replaceSubrange (bounds.offset (by: self.baseOffset), with: newValue) }
+		get {
+			return Slice (base: self, bounds: bounds);
+		}
+		set {
+			precondition (newValue.count == bounds.count, "Slice replacement must have the same length");
+			self.makeUniqueBuffer (minimumCapacity: self.count);
+			for (index, element) in zip (bounds, newValue) {
+				self.buffer [index - self.baseOffset] = element;
+			}
+		}
 	}
 }
 
 /* internal */ extension FloatingBaseArray /* RangeReplacementCollection subset */ {
 	internal init (baseOffset: Int = 0) {
-		self.backing = ContiguousArray ();
+		self.buffer = FloatingBaseArrayBuffer (capacity: 0);
 		self.baseOffset = baseOffset;
 	}
 
 	internal init (_ other: FloatingBaseArray) {
-		self.backing = other.backing;
+		self.buffer = other.buffer;
 		self.baseOffset = other.baseOffset;
 	}
 
 	internal init <S> (_ elements: S, baseOffset: Int = 0) where S: Sequence, S.Element == Element {
-		self.backing = ContiguousArray (elements);
-		self.baseOffset = baseOffset;
+		self.init (baseOffset: baseOffset);
+		self.append (contentsOf: elements);
 	}
 	
 	internal mutating func append (_ newElement: Element) {
-		self.backing.append (newElement);
+		self.makeUniqueBuffer (minimumCapacity: self.count + 1);
+		self.buffer.append (newElement);
 	}
 	
 	internal mutating func append <S> (contentsOf newElements: S) where S: Sequence, S.Element == Element {
-		self.backing.append (contentsOf: newElements);
+		self.makeUniqueBuffer (minimumCapacity: self.count + newElements.underestimatedCount);
+		for element in newElements {
+			self.append (element);
+		}
 	}
 	
 	internal mutating func prepend (_ newElement: Element) {
-		self.backing.insert (newElement, at: self.backing.startIndex);
+		self.makeUniqueBuffer (minimumCapacity: self.count + 1);
+		self.buffer.prepend (newElement);
 		self.baseOffset -= 1;
 	}
 	
 	internal mutating func prepend <C> (contentsOf newElements: C) where C: Collection, C.Element == Element {
-		self.backing.insert (contentsOf: newElements, at: self.backing.startIndex);
-		self.baseOffset -= newElements.count;
+		let newElementsCount = newElements.count;
+		self.makeUniqueBuffer (minimumCapacity: self.count + newElementsCount);
+		self.buffer.prepend (contentsOf: newElements, count: newElementsCount);
+		self.baseOffset -= newElementsCount;
 	}
 	
 	internal mutating func popLast () -> Element? {
@@ -100,11 +135,15 @@ extension FloatingBaseArray: MutableCollection, RandomAccessCollection {
 	}
 	
 	internal mutating func removeLast () -> Element {
-		return self.backing.removeLast ();
+		precondition (!self.isEmpty, "Can't remove last element from an empty collection");
+		self.makeUniqueBuffer (minimumCapacity: self.count);
+		return self.buffer.removeLast ();
 	}
 	
 	internal mutating func removeLast (_ k: Int) {
-		return self.backing.removeLast (k);
+		precondition ((0 ... self.count) ~= k, "Can't remove more items from a collection than it contains");
+		self.makeUniqueBuffer (minimumCapacity: self.count);
+		self.buffer.removeLast (k);
 	}
 	
 	internal mutating func popFirst () -> Element? {
@@ -112,17 +151,40 @@ extension FloatingBaseArray: MutableCollection, RandomAccessCollection {
 	}
 	
 	internal mutating func removeFirst () -> Element {
+		precondition (!self.isEmpty, "Can't remove first element from an empty collection");
+		self.makeUniqueBuffer (minimumCapacity: self.count);
 		self.baseOffset += 1;
-		return self.backing.removeFirst ();
+		return self.buffer.removeFirst ();
 	}
 	
 	internal mutating func removeFirst (_ k: Int) {
+		precondition ((0 ... self.count) ~= k, "Can't remove more items from a collection than it contains");
+		self.makeUniqueBuffer (minimumCapacity: self.count);
 		self.baseOffset += k;
-		return self.backing.removeFirst (k);
+		self.buffer.removeFirst (k);
+	}
+	
+	/// Removes all elements whose indices lie outside of the given window; indices of remaining elements are preserved.
+	///
+	/// - Parameter window: Range of indices to keep. If it does not overlap array indices, all elements are removed.
+	internal mutating func trim (to window: Range <Index>) {
+		let window = window.clamped (to: self.startIndex ..< self.endIndex);
+		self.removeLast (self.endIndex - window.upperBound);
+		self.removeFirst (window.lowerBound - self.startIndex);
 	}
 
 	internal mutating func reserveCapacity (_ capacity: Int) {
-		self.backing.reserveCapacity (capacity);
+		self.makeUniqueBuffer (minimumCapacity: capacity);
+	}
+	
+	private mutating func makeUniqueBuffer (minimumCapacity: Int) {
+		let isUnique = isKnownUniquelyReferenced (&self.buffer), capacity = self.buffer.capacity;
+		guard !isUnique || (capacity < minimumCapacity) else {
+			return;
+		}
+		
+		let newCapacity = (capacity < minimumCapacity) ? Swift.max (minimumCapacity, capacity * 2) : capacity;
+		self.buffer = isUnique ? self.buffer.movingElements (capacity: newCapacity) : self.buffer.copy (capacity: newCapacity);
 	}
 }
 
@@ -134,12 +196,6 @@ extension FloatingBaseArray: ExpressibleByArrayLiteral {
 	}
 }
 
-/* internal */ extension FloatingBaseArray {
-	func withUnsafeBufferPointer <R> (_ body: (UnsafeBufferPointer<Element>) throws -> R) rethrows -> R {
-		return try self.backing.withUnsafeBufferPointer (body);
-	}
-}
-
 /* internal */ extension Range where Bound: Strideable {
 	internal func offset (by offset: Bound.Stride) -> Range {
 		return self.lowerBound.advanced (by: offset) ..< self.upperBound.advanced (by: offset);
@@ -148,10 +204,9 @@ extension FloatingBaseArray: ExpressibleByArrayLiteral {
 
 /* internal */ extension FloatingBaseArray where Element: NSObject, Element: NSCopying {
 	internal init (_ other: FloatingBaseArray, copyItems: Bool) {
+		self.init (other);
 		if (copyItems) {
-			self.init (other.backing, baseOffset: other.baseOffset, copyItems: true);
-		} else {
-			self.init (other);
+			self.buffer = other.buffer.copy (capacity: other.count) { $0.copy () as! Element };
 		}
 	}
 
@@ -161,10 +216,139 @@ extension FloatingBaseArray: ExpressibleByArrayLiteral {
 			return;
 		}
 		
-		self.init (baseOffset: baseOffset);
-		self.backing.reserveCapacity (elements.underestimatedCount);
+		self.init (elements.lazy.map { $0.copy () as! Element }, baseOffset: baseOffset);
+	}
+}
+
+/// Fixed-capacity ring buffer that stores elements of `FloatingBaseArray`.
+private final class FloatingBaseArrayBuffer <Element> {
+	fileprivate let capacity: Int;
+	fileprivate private (set) var count: Int;
+	
+	private var head: Int;
+	private let elements: UnsafeMutablePointer <Element>;
+	
+	fileprivate init (capacity: Int) {
+		self.capacity = capacity;
+		self.count = 0;
+		self.head = 0;
+		self.elements = UnsafeMutablePointer.allocate (capacity: capacity);
+	}
+	
+	deinit {
+		self.removeFirst (self.count);
+		self.elements.deallocate ();
+	}
+	
+	fileprivate subscript (offset: Int) -> Element {
+		get {
+			return self.elements [self.storageIndex (offset)];
+		}
+		set {
+			self.elements [self.storageIndex (offset)] = newValue;
+		}
+	}
+	
+	fileprivate func append (_ element: Element) {
+		(self.elements + self.storageIndex (self.count)).initialize (to: element);
+		self.count += 1;
+	}
+	
+	fileprivate func prepend (_ element: Element) {
+		self.head = self.storageIndex (self.capacity - 1);
+		(self.elements + self.head).initialize (to: element);
+		self.count += 1;
+	}
+	
+	fileprivate func prepend <C> (contentsOf elements: C, count: Int) where C: Collection, C.Element == Element {
+		self.head = self.storageIndex (self.capacity - count);
+		var offset = 0;
 		for element in elements {
-			self.backing.append (element.copy () as! Element);
+			(self.elements + self.storageIndex (offset)).initialize (to: element);
+			offset += 1;
+		}
+		self.count += count;
+	}
+	
+	fileprivate func removeFirst () -> Element {
+		let result = (self.elements + self.head).move ();
+		self.head = self.storageIndex (1);
+		self.count -= 1;
+		return result;
+	}
+	
+	fileprivate func removeFirst (_ k: Int) {
+		self.deinitializeElements (in: 0 ..< k);
+		self.head = self.storageIndex (k);
+		self.count -= k;
+	}
+	
+	fileprivate func removeLast () -> Element {
+		self.count -= 1;
+		return (self.elements + self.storageIndex (self.count)).move ();
+	}
+	
+	fileprivate func removeLast (_ k: Int) {
+		self.deinitializeElements (in: (self.count - k) ..< self.count);
+		self.count -= k;
+	}
+	
+	/// Returns new buffer that contains copies of stored elements starting at its beginning.
+	fileprivate func copy (capacity: Int) -> FloatingBaseArrayBuffer {
+		let result = FloatingBaseArrayBuffer (capacity: capacity);
+		for (start, segment) in self.segments (of: 0 ..< self.count) {
+			(result.elements + start).initialize (from: self.elements + segment.lowerBound, count: segment.count);
+		}
+		result.count = self.count;
+		return result;
+	}
+	
+	/// Returns new buffer that contains transformed stored elements starting at its beginning.
+	fileprivate func copy (capacity: Int, transform: (Element) -> Element) -> FloatingBaseArrayBuffer {
+		let result = FloatingBaseArrayBuffer (capacity: capacity);
+		for offset in 0 ..< self.count {
+			(result.elements + offset).initialize (to: transform (self [offset]));
+		}
+		result.count = self.count;
+		return result;
+	}
+	
+	/// Moves stored elements into a new buffer, leaving this one empty.
+	fileprivate func movingElements (capacity: Int) -> FloatingBaseArrayBuffer {
+		let result = FloatingBaseArrayBuffer (capacity: capacity);
+		for (start, segment) in self.segments (of: 0 ..< self.count) {
+			(result.elements + start).moveInitialize (from: self.elements + segment.lowerBound, count: segment.count);
+		}
+		(result.count, self.count, self.head) = (self.count, 0, 0);
+		return result;
+	}
+	
+	private func storageIndex (_ offset: Int) -> Int {
+		let index = self.head + offset;
+		return (index < self.capacity) ? index : index - self.capacity;
+	}
+	
+	private func deinitializeElements (in offsets: Range <Int>) {
+		for (_, segment) in self.segments (of: offsets) {
+			(self.elements + segment.lowerBound).deinitialize (count: segment.count);
+		}
+	}
+	
+	/// Splits logical offsets into at most two contiguous storage ranges.
+	///
+	/// - Returns: Pairs of logical offset of the first element in a segment and storage range of the segment.
+	private func segments (of offsets: Range <Int>) -> [(start: Int, storage: Range <Int>)] {
+		guard !offsets.isEmpty else {
+			return [];
+		}
+		
+		let lowerIndex = self.storageIndex (offsets.lowerBound), upperIndex = self.storageIndex (offsets.upperBound - 1) + 1;
+		if (lowerIndex < upperIndex) {
+			return [(start: offsets.lowerBound, storage: lowerIndex ..< upperIndex)];
 		}
+		return [
+			(start: offsets.lowerBound, storage: lowerIndex ..< self.capacity),
+			(start: offsets.lowerBound + self.capacity - lowerIndex, storage: 0 ..< upperIndex),
+		];
 	}
 }
@@ -0,0 +1,135 @@
+//
+//  FloatingBasePrefixSums.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Swift
+
+/// Sequence of non-negative values addressed by arbitrary (possibly negative) integer indices that answers
+/// range sum and inverse prefix sum queries in logarithmic time (Fenwick tree).
+///
+/// Values that were never assigned are zero. Storage grows in both directions with amortized constant cost.
+internal struct FloatingBasePrefixSums <Value> where Value: Numeric, Value: Comparable {
+	private var values: ContiguousArray <Value>;
+	/// Fenwick tree over `values`; `tree [0]` is unused.
+	private var tree: ContiguousArray <Value>;
+	private var baseOffset: Int;
+	
+	/// Indices that are currently backed by storage.
+	internal var indices: Range <Int> {
+		return self.baseOffset ..< self.baseOffset + self.values.count;
+	}
+	
+	internal init (baseOffset: Int = 0) {
+		self.values = [];
+		self.tree = [0];
+		self.baseOffset = baseOffset;
+	}
+	
+	internal subscript (index: Int) -> Value {
+		get {
+			return self.indices ~= index ? self.values [index - self.baseOffset] : 0;
+		}
+		set {
+			self.reserveIndices (index ..< index + 1);
+			let position = index - self.baseOffset, delta = newValue - self.values [position];
+			self.values [position] = newValue;
+			var treeIndex = position + 1;
+			while (treeIndex < self.tree.count) {
+				self.tree [treeIndex] += delta;
+				treeIndex += treeIndex & -treeIndex;
+			}
+		}
+	}
+	
+	/// Returns sum of values at the given indices.
+	internal func sum (of range: Range <Int>) -> Value {
+		let range = range.clamped (to: self.indices);
+		return self.prefixSum (count: range.upperBound - self.baseOffset) - self.prefixSum (count: range.lowerBound - self.baseOffset);
+	}
+	
+	/// Finds index of the value that covers the given offset when values are laid out one after another
+	/// starting at `startIndex`.
+	///
+	/// - Parameters:
+	///   - offset: Offset relative to the start of value at `startIndex`.
+	///   - startIndex: Index of the first value.
+	/// - Returns: Largest index `i` such that sum of values in `startIndex ..< i` does not exceed `offset`, or `nil` if `offset` is negative.
+	internal func index (containing offset: Value, from startIndex: Int) -> Int? {
+		guard (offset >= 0) else {
+			return nil;
+		}
+		
+		let startCount = min (max (startIndex - self.baseOffset, 0), self.values.count);
+		var remainder = offset + self.prefixSum (count: startCount), position = 0, step = 1;
+		while (step * 2 < self.tree.count) {
+			step *= 2;
+		}
+		while (step > 0) {
+			if (position + step < self.tree.count), (self.tree [position + step] <= remainder) {
+				position += step;
+				remainder -= self.tree [position];
+			}
+			step /= 2;
+		}
+		return max (position + self.baseOffset, startIndex);
+	}
+	
+	/// Ensures that values at the given indices are backed by storage.
+	internal mutating func reserveIndices (_ range: Range <Int>) {
+		let currentIndices = self.indices;
+		guard !range.isEmpty, (range.lowerBound < currentIndices.lowerBound) || (range.upperBound > currentIndices.upperBound) else {
+			return;
+		}
+		
+		let slack = max (self.values.count, 16);
+		let lowerBound = (range.lowerBound < currentIndices.lowerBound) ? range.lowerBound - slack : currentIndices.lowerBound;
+		let upperBound = (range.upperBound > currentIndices.upperBound) ? range.upperBound + slack : currentIndices.upperBound;
+		
+		var values = ContiguousArray <Value> (repeating: 0, count: upperBound - lowerBound);
+		let copyStart = currentIndices.lowerBound - lowerBound;
+		values.replaceSubrange (copyStart ..< copyStart + self.values.count, with: self.values);
+		self.values = values;
+		self.baseOffset = lowerBound;
+		self.rebuildTree ();
+	}
+	
+	private func prefixSum (count: Int) -> Value {
+		var result = 0 as Value, treeIndex = count;
+		while (treeIndex > 0) {
+			result += self.tree [treeIndex];
+			treeIndex -= treeIndex & -treeIndex;
+		}
+		return result;
+	}
+	
+	private mutating func rebuildTree () {
+		var tree = ContiguousArray <Value> (repeating: 0, count: self.values.count + 1);
+		for treeIndex in 1 ..< tree.count {
+			tree [treeIndex] += self.values [treeIndex - 1];
+			let parentIndex = treeIndex + (treeIndex & -treeIndex);
+			if (parentIndex < tree.count) {
+				tree [parentIndex] += tree [treeIndex];
+			}
+		}
+		self.tree = tree;
+	}
+}
@@ -37,12 +37,16 @@ import Swift
 	}
 }
 
-/* internal */ extension Set {
-	internal func union (_ element: Element) -> Set {
-		return self.union (CollectionOfOne (element));
+/* internal */ extension SetAlgebra {
+	internal func union (_ element: Element) -> Self {
+		var result = self;
+		result.insert (element);
+		return result;
 	}
 	
-	internal func subtracting (_ element: Element) -> Set {
-		return self.subtracting (CollectionOfOne (element));
+	internal func subtracting (_ element: Element) -> Self {
+		var result = self;
+		result.remove (element);
+		return result;
 	}
 }
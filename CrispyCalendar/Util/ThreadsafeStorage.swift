@@ -22,8 +22,15 @@
 //
 
 import Swift
-import os.lock
 import Dispatch
+#if canImport (os)
+import os.lock
+#endif
+#if canImport (Darwin)
+import Darwin
+#elseif canImport (Glibc)
+import Glibc
+#endif
 
 internal protocol ThreadsafeStorageProtocol {
 	associatedtype ValueType;
@@ -46,11 +53,13 @@ internal struct ThreadsafeStorage <Lock, Value> {
 	}
 }
 
+#if canImport (os)
 /* internal */ extension ThreadsafeStorage where Lock == os_unfair_lock {
 	internal init (_ value: Value) {
 		self.init (lock: UnfairLockWrapper (), value: value);
 	}
 }
+#endif
 
 /* internal */ extension ThreadsafeStorage where Lock == DispatchSemaphore {
 	internal init (_ value: Value) {
@@ -58,6 +67,12 @@ internal struct ThreadsafeStorage <Lock, Value> {
 	}
 }
 
+/* internal */ extension ThreadsafeStorage where Lock == pthread_mutex_t {
+	internal init (_ value: Value) {
+		self.init (lock: PThreadMutexWrapper (), value: value);
+	}
+}
+
 /* internal */ extension ThreadsafeStorage where Lock == pthread_rwlock_t {
 	internal init (_ value: Value) {
 		self.init (lock: PThreadRWLockWrapper (), value: value);
@@ -76,25 +91,107 @@ extension ThreadsafeStorage: ThreadsafeStorageProtocol {
 		}
 	}
 	
+	/// Performs read-only access to the stored value. Readers may run concurrently if underlying lock supports it.
 	internal func withStoredValue <T> (perform block: (Value) -> T) -> T {
+		CPCInstrumentation.record (.lockAcquisitions);
 		self.wrappedLock.beginAccessingValue ();
-		let result = block (self.valueStorage);
-		self.wrappedLock.endAccessingValue ();
-		return result;
+		defer { self.wrappedLock.endAccessingValue () };
+		return block (self.valueStorage);
 	}
 	
+	/// Performs exclusive read-write access to the stored value.
 	internal mutating func withMutableStoredValue <T> (perform block: (inout Value) -> T) -> T {
-		self.wrappedLock.beginAccessingValue ();
-		let result = block (&self.valueStorage);
-		self.wrappedLock.endAccessingValue ();
-		return result;
+		CPCInstrumentation.record (.lockAcquisitions);
+		self.wrappedLock.beginAccessingMutableValue ();
+		defer { self.wrappedLock.endAccessingMutableValue () };
+		return block (&self.valueStorage);
 	}
 }
 
+#if canImport (os)
 internal typealias UnfairThreadsafeStorage <Value> = ThreadsafeStorage <os_unfair_lock, Value>;
+#else
+internal typealias UnfairThreadsafeStorage <Value> = ThreadsafeStorage <pthread_mutex_t, Value>;
+#endif
 internal typealias DispatchSemaphoreStorage <Value> = ThreadsafeStorage <DispatchSemaphore, Value>;
+internal typealias PThreadMutexStorage <Value> = ThreadsafeStorage <pthread_mutex_t, Value>;
 internal typealias PThreadRWLockStorage <Value> = ThreadsafeStorage <pthread_rwlock_t, Value>;
 
+/// Storage for read-mostly values that publishes immutable snapshots of stored value (RCU-style).
+///
+/// Readers only grab a reference to the current snapshot and never wait for a writer to finish its work;
+/// writers are serialized, mutate a private copy of the value and then atomically replace current snapshot.
+/// Writes are O(n) in the size of stored value, so this storage should only be used for rarely changing values.
+internal struct SnapshotThreadsafeStorage <Value> {
+	internal typealias ValueType = Value;
+	
+	private final class Snapshot {
+		fileprivate let value: Value;
+		
+		fileprivate init (_ value: Value) {
+			self.value = value;
+		}
+	}
+	
+	private final class SnapshotPublisher {
+		private let snapshotLock: LockWrapperProtocol;
+		private let writersLock: LockWrapperProtocol;
+		private var current: Snapshot;
+		
+		fileprivate var snapshot: Snapshot {
+			self.snapshotLock.beginAccessingValue ();
+			defer { self.snapshotLock.endAccessingValue () };
+			return self.current;
+		}
+		
+		fileprivate init (_ value: Value) {
+			self.snapshotLock = makeShortSectionLockWrapper ();
+			self.writersLock = PThreadMutexWrapper ();
+			self.current = Snapshot (value);
+		}
+		
+		fileprivate func update <T> (using block: (inout Value) -> T) -> T {
+			CPCInstrumentation.record (.lockAcquisitions);
+			self.writersLock.beginAccessingMutableValue ();
+			defer { self.writersLock.endAccessingMutableValue () };
+
+			var value = self.current.value;
+			let result = block (&value);
+			let updatedSnapshot = Snapshot (value);
+			self.snapshotLock.beginAccessingMutableValue ();
+			self.current = updatedSnapshot;
+			self.snapshotLock.endAccessingMutableValue ();
+			return result;
+		}
+	}
+	
+	private let publisher: SnapshotPublisher;
+	
+	internal init (_ value: Value) {
+		self.publisher = SnapshotPublisher (value);
+	}
+}
+
+extension SnapshotThreadsafeStorage: ThreadsafeStorageProtocol {
+	internal var value: Value {
+		get {
+			return self.publisher.snapshot.value;
+		}
+		set {
+			self.publisher.update { $0 = newValue };
+		}
+	}
+	
+	internal func withStoredValue <T> (perform block: (Value) -> T) -> T {
+		let snapshot = self.publisher.snapshot;
+		return withExtendedLifetime (snapshot) { block (snapshot.value) };
+	}
+	
+	internal mutating func withMutableStoredValue <T> (perform block: (inout Value) -> T) -> T {
+		return self.publisher.update (using: block);
+	}
+}
+
 private protocol LockWrapperProtocol: AnyObject {
 	func beginAccessingValue ();
 	func endAccessingValue ();
@@ -112,6 +209,16 @@ extension LockWrapperProtocol {
 	}
 }
 
+/// Creates the cheapest available lock for very short critical sections.
+private func makeShortSectionLockWrapper () -> LockWrapperProtocol {
+#if canImport (os)
+	return UnfairLockWrapper ();
+#else
+	return PThreadMutexWrapper ();
+#endif
+}
+
+#if canImport (os)
 private final class UnfairLockWrapper: LockWrapperProtocol {
 	private var lock: os_unfair_lock;
 	
@@ -127,6 +234,7 @@ private final class UnfairLockWrapper: LockWrapperProtocol {
 		os_unfair_lock_unlock (&self.lock);
 	}
 }
+#endif
 
 extension DispatchSemaphore: LockWrapperProtocol {
 	fileprivate convenience init (asLockWrapper: ()) {
@@ -142,28 +250,58 @@ extension DispatchSemaphore: LockWrapperProtocol {
 	}
 }
 
+private final class PThreadMutexWrapper: LockWrapperProtocol {
+	private let lock: UnsafeMutablePointer <pthread_mutex_t>;
+	
+	fileprivate init () {
+		self.lock = .allocate (capacity: 1);
+		self.lock.initialize (to: pthread_mutex_t ());
+		pthread_mutex_init (self.lock, nil);
+	}
+	
+	deinit {
+		pthread_mutex_destroy (self.lock);
+		self.lock.deinitialize (count: 1);
+		self.lock.deallocate ();
+	}
+	
+	fileprivate func beginAccessingValue () {
+		pthread_mutex_lock (self.lock);
+	}
+	
+	fileprivate func endAccessingValue () {
+		pthread_mutex_unlock (self.lock);
+	}
+}
+
 private final class PThreadRWLockWrapper: LockWrapperProtocol {
-	private var lock: pthread_rwlock_t;
+	private let lock: UnsafeMutablePointer <pthread_rwlock_t>;
 
 	fileprivate init () {
-		self.lock = pthread_rwlock_t ();
-		pthread_rwlock_init (&self.lock, nil);
+		self.lock = .allocate (capacity: 1);
+		self.lock.initialize (to: pthread_rwlock_t ());
+		pthread_rwlock_init (self.lock, nil);
 	}
 	
 	deinit {
-		pthread_rwlock_destroy (&self.lock);
+		pthread_rwlock_destroy (self.lock);
+		self.lock.deinitialize (count: 1);
+		self.lock.deallocate ();
 	}
 	
 	fileprivate func beginAccessingValue () {
-		pthread_rwlock_rdlock (&self.lock);
+		pthread_rwlock_rdlock (self.lock);
 	}
 	
 	fileprivate func beginAccessingMutableValue () {
-		pthread_rwlock_wrlock (&self.lock);
+		pthread_rwlock_wrlock (self.lock);
 	}
 	
 	fileprivate func endAccessingValue () {
-		pthread_rwlock_unlock (&self.lock);
+		pthread_rwlock_unlock (self.lock);
+	}
+	
+	fileprivate func endAccessingMutableValue () {
+		pthread_rwlock_unlock (self.lock);
 	}
 }
-
@@ -83,6 +83,9 @@ open class CPCCalendarView: UIView {
 	// MARK: - Public properties
 	
 	/// Calendar to be used for various locale-dependent info.
+	///
+	/// - Note: Changing calendar converts current `selection` to the new calendar and assigns the result back, so
+	///   the selection stored by `selectionDelegate` is replaced with days of the new calendar.
 	open var calendar: Calendar {
 		get { return self.calendarWrapper.calendar }
 		set {
@@ -109,16 +112,27 @@ open class CPCCalendarView: UIView {
 	}
 	
 	/// The minimum date that a calendar view should present to user. Defaults to `nil` meaning no lower limit.
+	///
+	/// - Note: The value is preserved when `calendar` is changed.
 	open var minimumDate: Date? {
 		get { return self.dataSource.minimumDate }
 		set { self.dataSource.minimumDate = newValue }
 	}
 	
 	/// The maximum date that a calendar view should present to user. Defaults to `nil` meaning no upper limit.
+	///
+	/// - Note: The value is preserved when `calendar` is changed.
 	open var maximumDate: Date? {
 		get { return self.dataSource.maximumDate }
 		set { self.dataSource.maximumDate = newValue }
 	}
+	
+	/// Days that user may select, e.g. to exclude blackout periods. Days outside of `minimumDate` & `maximumDate` are never available,
+	/// regardless of this value. Defaults to all days.
+	open var availableDays: CPCDayIntervalSet {
+		get { return self.dataSource.availableDays }
+		set { self.dataSource.availableDays = newValue }
+	}
 
 	/// The number of columns to display in a calendar view.
 	@IBInspectable open dynamic var columnCount: Int {
@@ -281,6 +295,11 @@ extension CPCCalendarView {
 			let dataSource = DataSource (replacing: self.dataSource, calendar: newValue);
 			self.prepareCollectionView (self.collectionView, using: dataSource);
 			self.dataSource = dataSource;
+			
+			let selection = self.selection.converted (to: newValue);
+			if (selection != self.selection) {
+				self.selection = selection;
+			}
 		}
 	}
 	
@@ -439,6 +458,9 @@ extension CPCCalendarView: CPCViewDelegatingSelectionHandling {
 	internal func resetSelection (in delegate: CPCCalendarViewSelectionDelegate) {}
 	
 	internal func handlerShouldSelectDayCell (_ day: CPCDay, delegate: CPCCalendarViewSelectionDelegate) -> Bool {
+		guard self.dataSource.enabledDays.contains (day) else {
+			return false;
+		}
 		return delegate.calendarView (self, shouldSelect: day);
 	}
 	
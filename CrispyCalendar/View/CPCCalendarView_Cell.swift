@@ -36,9 +36,9 @@ extension CPCCalendarView {
 			set { self.monthViewsManagerPtr = UnsafePointer (to: newValue) }
 		}
 		
-		internal var enabledRegion: CountableRange <CPCDay>? {
-			get { return self.monthView.enabledRegion }
-			set { self.monthView.enabledRegion = newValue }
+		internal var enabledDays: CPCDayIntervalSet {
+			get { return self.monthView.enabledDays }
+			set { self.monthView.enabledDays = newValue }
 		}
 		
 		internal var month: CPCMonth? {
@@ -31,14 +31,31 @@ import UIKit
 			return self.startingDay.calendarWrapper;
 		}
 		
-		internal var minimumDate: Date?;
+		internal var minimumDate: Date? {
+			didSet {
+				self.updateEnabledDays ();
+			}
+		}
+		
+		internal var maximumDate: Date? {
+			didSet {
+				self.updateEnabledDays ();
+			}
+		}
+		
+		internal var availableDays = CPCDayIntervalSet.all {
+			didSet {
+				self.updateEnabledDays ();
+			}
+		}
 		
-		internal var maximumDate: Date?;
+		/// Days that may be selected by user, i.e. available days clamped to minimum & maximum dates.
+		internal private (set) var enabledDays = CPCDayIntervalSet.all;
 
 		internal let startingDay: CPCDay;		
 		internal let monthViewsManager: CPCMonthViewsManager;
 
-		private let cache: Cache;
+		private let months: CPCMonthsWindow;
 		private let referenceIndexPath: IndexPath;
 
 		internal override convenience init () {
@@ -49,7 +66,7 @@ import UIKit
 			self.startingDay = startingDay;
 			self.monthViewsManager = CPCMonthViewsManager ();
 			self.referenceIndexPath = IndexPath (referenceForDay: startingDay);
-			self.cache = Cache (startingYear: startingDay.containingYear);
+			self.months = CPCMonthsWindow (startingYear: startingDay.containingYear, referenceItem: .zerothVirtualItemIndex);
 			super.init ();
 		}
 		
@@ -62,10 +79,16 @@ import UIKit
 		}
 		
 		internal init (replacing oldSource: DataSource, calendar: CPCCalendarWrapper) {
-			self.startingDay = CPCDay (containing: oldSource.startingDay.start, calendar: calendar);
+			var reprojection = CPCCalendarUnitsReprojection (from: oldSource.calendar, to: calendar);
+			self.startingDay = reprojection.day (oldSource.startingDay);
 			self.monthViewsManager = oldSource.monthViewsManager;
 			self.referenceIndexPath = IndexPath (referenceForDay: self.startingDay);
-			self.cache = Cache (startingYear: self.startingDay.containingYear);
+			self.months = CPCMonthsWindow (reprojecting: oldSource.months, startingYear: self.startingDay.containingYear, referenceItem: .zerothVirtualItemIndex, using: &reprojection);
+			self.minimumDate = oldSource.minimumDate;
+			self.maximumDate = oldSource.maximumDate;
+			self.availableDays = oldSource.availableDays.converted (to: calendar);
+			super.init ();
+			self.updateEnabledDays ();
 		}
 	}
 }
@@ -103,10 +126,10 @@ extension CPCCalendarView.DataSource: UICollectionViewDataSourcePrefetching {
 			return;
 		}
 		if (self.cachedMonth (for: minIndexPath) == nil) {
-			self.cache.fetchCacheItems (for: minIndexPath, highPriority: false, completion: self.monthsUpdateHandler (collectionView));
+			self.prepareCacheData (for: minIndexPath, highPriority: false, collectionView: collectionView);
 		}
 		if (self.cachedMonth (for: maxIndexPath) == nil) {
-			self.cache.fetchCacheItems (for: minIndexPath, highPriority: false, completion: self.monthsUpdateHandler (collectionView));
+			self.prepareCacheData (for: maxIndexPath, highPriority: false, collectionView: collectionView);
 		}
 	}
 }
@@ -142,164 +165,43 @@ extension CPCCalendarView.DataSource: CPCCalendarViewLayoutDelegate {
 	}
 	
 	internal func collectionView (_ collectionView: UICollectionView, startOfSectionFor indexPath: IndexPath) -> IndexPath {
-		let month = self.cache.month (for: indexPath), year = month.containingYear, monthIndex = year.index (of: month)!;
+		let month = self.months.month (at: indexPath.item), year = month.containingYear, monthIndex = year.index (of: month)!;
 		return indexPath.offset (by: year.distance (from: monthIndex, to: year.startIndex));
 	}
 	
 	internal func collectionView (_ collectionView: UICollectionView, endOfSectionFor indexPath: IndexPath) -> IndexPath {
-		let month = self.cache.month (for: indexPath), year = month.containingYear, monthIndex = year.index (of: month)!;
+		let month = self.months.month (at: indexPath.item), year = month.containingYear, monthIndex = year.index (of: month)!;
 		return indexPath.offset (by: year.distance (from: monthIndex, to: year.endIndex));
 	}
 	
 	internal func collectionView (_ collectionView: UICollectionView, willDisplay cell: UICollectionViewCell, forItemAt indexPath: IndexPath) {
+		self.months.noteDisplayedItem (indexPath.item);
 		if let cell = cell as? CPCCalendarView.Cell {
 			cell.monthViewsManager = self.monthViewsManager;
 			cell.month = self.cachedMonth (for: indexPath);
-			
-			let minimumDay: CPCDay?, maximumDay: CPCDay?;
-			if let minimumDate = self.minimumDate {
-				minimumDay = CPCDay (containing: minimumDate, calendar: self.calendar);
-			} else {
-				minimumDay = nil;
-			}
-			if let maximumDate = self.maximumDate {
-				maximumDay = CPCDay (containing: maximumDate, calendar: self.calendar);
-			} else {
-				maximumDay = nil;
-			}
-			switch (minimumDay, maximumDay) {
-			case (nil, nil):
-				cell.enabledRegion = nil;
-			case (.some (let minimumDay), nil):
-				cell.enabledRegion = minimumDay ..< CPCDay (containing: .distantFuture, calendar: self.calendar);
-			case (nil, .some (let maximumDay)):
-				cell.enabledRegion = CPCDay (containing: .distantPast, calendar: self.calendar) ..< maximumDay;
-			case (.some (let minimumDay), .some (let maximumDay)):
-				cell.enabledRegion = minimumDay ..< maximumDay;
-			}
+			cell.enabledDays = self.enabledDays;
 		}
 	}
 }
 
-private extension CPCCalendarView.DataSource {
-	private final class Cache {
-		private var cachedMonths: FloatingBaseArray <CPCMonth>;
-		private var updatesLock = DispatchSemaphore (value: 1);
-		private var firstCalculatedIndexPath = UnfairThreadsafeStorage (IndexPath?.none);
-		private var lastCalculatedIndexPath = UnfairThreadsafeStorage (IndexPath?.none);
-
-		private let backgroundQueue = DispatchQueue (label: "CPCCalendarDataSourceCache", qos: .default, attributes: .concurrent);
-		private let priorityQueue = DispatchQueue (label: "CPCCalendarDataSourceCeche", qos: .userInteractive, attributes: .concurrent);
-		
-		fileprivate init (startingYear: CPCYear) {
-			let prevYear = startingYear.prev, nextYear = startingYear.next;
-			self.cachedMonths = FloatingBaseArray (Array (prevYear) + startingYear + nextYear, baseOffset: .zerothVirtualItemIndex - prevYear.count);
-		}
-		
-		fileprivate func cachedMonth (for indexPath: IndexPath) -> CPCMonth? {
-			return self.cachedMonths.indices.contains (indexPath.item) ? self.cachedMonths [indexPath.item] : nil;
-		}
-		
-		fileprivate func month (for indexPath: IndexPath) -> CPCMonth {
-			let nearestMonthIndex: Int;
-			if (indexPath.item < self.cachedMonths.startIndex) {
-				nearestMonthIndex = self.cachedMonths.startIndex;
-			} else if (indexPath.item >= self.cachedMonths.endIndex) {
-				nearestMonthIndex = self.cachedMonths.endIndex - 1;
-			} else {
-				return self.cachedMonths [indexPath.item];
-			}
-			
-			return self.cachedMonths [nearestMonthIndex].advanced (by: indexPath.item - nearestMonthIndex);
+/* fileprivate */ extension CPCCalendarView.DataSource {
+	private func updateEnabledDays () {
+		let calendar = self.calendar;
+		var enabledDays = self.availableDays.converted (to: calendar);
+		if let minimumDate = self.minimumDate {
+			enabledDays.formIntersection (CPCDayIntervalSet (CPCDay (containing: minimumDate, calendar: calendar)...));
 		}
-		
-		fileprivate func fetchCacheItems (for indexPath: IndexPath, highPriority: Bool, completion: @escaping (_ updated: [IndexPath]) -> ()) {
-			let canCalculateEarlierMonths: Bool = self.firstCalculatedIndexPath.withMutableStoredValue {
-				if let currentFirstIndexPath = $0, (indexPath >= currentFirstIndexPath) {
-					return false;
-				}
-				$0 = indexPath;
-				return true;
-			}
-			let canCalculateLaterMonths: Bool = self.lastCalculatedIndexPath.withMutableStoredValue {
-				if let currentLastIndexPath = $0, (indexPath < currentLastIndexPath) {
-					return false;
-				}
-				$0 = indexPath.offset (by: -1);
-				return true;
-			}
-
-			guard (canCalculateLaterMonths || canCalculateEarlierMonths), !(self.cachedMonths.indices ~= indexPath.item) else {
-				return;
-			}
-			(highPriority ? self.priorityQueue : self.backgroundQueue).async { self.calculateAndStoreYears (untilReaching: indexPath, completion: completion) };
+		if let maximumDate = self.maximumDate {
+			enabledDays.formIntersection (CPCDayIntervalSet (..<CPCDay (containing: maximumDate, calendar: calendar)));
 		}
-		
-		private func determineCalculationAttributes (for indexPath: IndexPath) -> (start: CPCMonth, targetCount: Int, advance: Int)? {
-			self.updatesLock.wait ();
-			defer { self.updatesLock.signal () }
-
-			if (indexPath.item < self.cachedMonths.startIndex) {
-				return (
-					start: self.cachedMonths [self.cachedMonths.startIndex],
-					targetCount: self.cachedMonths.startIndex - indexPath.item,
-					advance: -1
-				);
-			} else if (indexPath.item >= self.cachedMonths.endIndex) {
-				return (
-					start: self.cachedMonths [self.cachedMonths.endIndex - 1],
-					targetCount: indexPath.item - self.cachedMonths.endIndex + 1,
-					advance: 1
-				);
-			} else {
-				return nil;
-			}
+		guard enabledDays != self.enabledDays else {
+			return;
 		}
 		
-		private func calculateAndStoreYears (untilReaching indexPath: IndexPath, completion: @escaping (_ updated: [IndexPath]) -> ()) {
-			guard let (start, targetCount, advance) = self.determineCalculationAttributes (for: indexPath) else {
-				return;
-			}
-			
-			var months = [CPCMonth] (), minimumIndexPath: IndexPath?, maximumIndexPath: IndexPath?;
-			months.reserveCapacity (targetCount);
-			for _ in 0 ..< targetCount {
-				months.append ((months.last ?? start).advanced (by: advance));
-			}
-			let lastMonth = months.last ?? start, lastYear = lastMonth.containingYear, monthIndex = lastYear.index (of: lastMonth)!, endIndexPath: IndexPath;
-			if (advance > 0) {
-				let additionalMonths = lastYear [lastYear.index (after: monthIndex)...];
-				months.append (contentsOf: additionalMonths);
-				endIndexPath = indexPath.offset (by: additionalMonths.count)
-			} else {
-				let additionalMonths = lastYear [..<monthIndex];
-				months.append (contentsOf: additionalMonths.reversed ());
-				endIndexPath = indexPath.offset (by: -additionalMonths.count);
-			}
-			
-			self.updatesLock.wait ();
-			defer { self.updatesLock.signal () }
-			
-			let indexPaths: [IndexPath];
-			if (endIndexPath.item < self.cachedMonths.startIndex) {
-				indexPaths = (endIndexPath.item ..< self.cachedMonths.startIndex).map { IndexPath (item: $0, section: 0) };
-				self.cachedMonths.prepend (contentsOf: months.suffix (indexPaths.count).reversed ());
-			} else if (endIndexPath.item >= self.cachedMonths.endIndex) {
-				indexPaths = (self.cachedMonths.endIndex ... endIndexPath.item).map { IndexPath (item: $0, section: 0) };
-				self.cachedMonths.append (contentsOf: months.suffix (indexPaths.count));
-			} else {
-				return;
-			}
-
-			DispatchQueue.main.async {
-				completion (indexPaths);
-			};
-		}
+		self.enabledDays = enabledDays;
+		self.monthViewsManager.updateManagedMonthViews (using: { $0.enabledDays = enabledDays });
 	}
-}
-
-
-/* fileprivate */ extension CPCCalendarView.DataSource {
+	
 	fileprivate var startingMonth: CPCMonth {
 		return self.startingDay.containingMonth;
 	}
@@ -309,15 +211,15 @@ private extension CPCCalendarView.DataSource {
 	}
 	
 	fileprivate func cachedMonth (for indexPath: IndexPath) -> CPCMonth? {
-		return self.cache.cachedMonth (for: indexPath);
+		return self.months.cachedMonth (at: indexPath.item);
 	}
 	
 	private func prepareCacheData (for indexPath: IndexPath, highPriority: Bool, collectionView: UICollectionView) {
-		self.cache.fetchCacheItems (for: indexPath, highPriority: highPriority, completion: self.monthsUpdateHandler (collectionView));
+		self.months.fetchMonths (upTo: indexPath.item, highPriority: highPriority, updateHandler: self.monthsUpdateHandler (collectionView));
 	}
 	
-	private func monthsUpdateHandler (_ collectionView: UICollectionView) -> ([IndexPath]) -> () {
-		return { [weak self, weak collectionView] indexPaths in
+	private func monthsUpdateHandler (_ collectionView: UICollectionView) -> CPCMonthsWindow.UpdateHandler {
+		return { [weak self, weak collectionView] updatedItems in
 			guard let strongSelf = self else {
 				return;
 			}
@@ -325,7 +227,7 @@ private extension CPCCalendarView.DataSource {
 			guard let collectionView = collectionView, collectionView.dataSource === strongSelf else {
 				return;
 			}
-			collectionView.reloadItems (at: indexPaths);
+			collectionView.reloadItems (at: updatedItems.map { IndexPath (item: $0, section: 0) });
 		}
 	}
 
@@ -77,10 +77,7 @@ import UIKit
 				return .unspecified
 			}
 				
-			let start = row(at: visibleRowsRange.lowerBound)
-			let end = row(at: targetIndex)
-				
-			return .absolute(end.frame.maxY - start.frame.minY)
+			return .absolute(rowHeights.sum(of: visibleRowsRange.lowerBound ..< targetIndex + 1))
 		}
 
 		// MARK: - Private properties
@@ -99,6 +96,8 @@ import UIKit
 		
 		private var contentGuide: Range <CGFloat>;
 		private var rawAttributes: FloatingBaseArray <Attributes>;
+		/// Heights of rows that were laid out, indexed by row index.
+		private var rowHeights = FloatingBasePrefixSums <CGFloat> ();
 		private var incompleteRowLengths = [Int: Int] ();
 		private var middleRowOrigin: CGFloat;
 		private var validatedRows: ClosedRange <Int>?;
@@ -501,21 +500,13 @@ import UIKit
 		if (allowAfterLast && (verticalOffset >= self.row (at: validatedRows.upperBound).frame.maxY)) {
 			return self.row (at: self.lastRowIndex - 1);
 		}
-		return self.rawAttributes.binarySearch (withGranularity: self.columnCount) {
-			let row = $0.position.row;
-			guard validatedRows ~= row else {
-				return (row > 0) ? .orderedAscending : .orderedDescending;
-			}
-			
-			let relativeOffset = verticalOffset - $0.frame.minY;
-			if (relativeOffset < 0.0) {
-				return .orderedAscending;
-			} else if (relativeOffset > $0.rowHeight) {
-				return .orderedDescending;
-			} else {
-				return .orderedSame;
-			}
-		}.map { self.row (at: $0 / self.columnCount) };
+		
+		let relativeOffset = verticalOffset - self.row (at: validatedRows.lowerBound).frame.minY;
+		guard (relativeOffset <= self.rowHeights.sum (of: validatedRows.lowerBound ..< validatedRows.upperBound + 1)),
+			let rowIndex = self.rowHeights.index (containing: relativeOffset, from: validatedRows.lowerBound) else {
+			return nil;
+		}
+		return self.row (at: min (rowIndex, validatedRows.upperBound));
 	}
 	
 	@discardableResult
@@ -529,6 +520,13 @@ import UIKit
 	}
 	
 	private func layoutRow (_ row: Row, at index: Int) -> Row {
+		defer {
+			let rowHeight = row.frame.height;
+			if let validatedRows = self.validatedRows, validatedRows ~= index, self.rowHeights [index] != rowHeight {
+				self.rowHeights [index] = rowHeight;
+			}
+		}
+		
 		if let reference = row.reference {
 			let referenceFrame: CGRect;
 			if let validatedRows = self.validatedRows, validatedRows ~= reference.index {
@@ -606,31 +604,25 @@ import UIKit
 	}
 }
 
-private protocol UnsafeBufferRepresentable: RandomAccessCollection {
-	func withUnsafeBufferPointer <R> (_ body: (UnsafeBufferPointer <Element>) throws -> R) rethrows -> R;
-}
-extension Array: UnsafeBufferRepresentable {}
-extension ContiguousArray: UnsafeBufferRepresentable {}
-extension ArraySlice: UnsafeBufferRepresentable {}
-extension FloatingBaseArray: UnsafeBufferRepresentable {}
-
-extension UnsafeBufferRepresentable where Index: BinaryInteger {
+extension RandomAccessCollection where Index: BinaryInteger {
 	fileprivate func binarySearch (withGranularity granularity: Index = 1, using comparator: (Element) -> ComparisonResult) -> Index? {
-		return self.withUnsafeBufferPointer { buffer in
-			let base = buffer.baseAddress!;
-			return withoutActuallyEscaping (comparator) { comparator in
-				guard let found = bsearch_b (nil, UnsafeRawPointer (base), self.count / Int (granularity), MemoryLayout <Element>.stride * Int (granularity), { _, element in
-					return Int32 (comparator (element!.assumingMemoryBound (to: Element.self).pointee).rawValue);
-				}) else {
-					return nil;
-				};
-				return self.startIndex.advanced (by: base.distance (to: found.assumingMemoryBound (to: Element.self)));
+		var lowerBound = 0, upperBound = self.count / Int (granularity);
+		while (lowerBound < upperBound) {
+			let middle = lowerBound + (upperBound - lowerBound) / 2, index = self.startIndex + Index (middle) * granularity;
+			switch (comparator (self [index])) {
+			case .orderedAscending:
+				upperBound = middle;
+			case .orderedDescending:
+				lowerBound = middle + 1;
+			case .orderedSame:
+				return index;
 			}
-		};
+		}
+		return nil;
 	}
 }
 
-extension UnsafeBufferRepresentable where Index: BinaryInteger, Element: Comparable {
+extension RandomAccessCollection where Index: BinaryInteger, Element: Comparable {
 	fileprivate func binarySearch (of element: Element) -> Index? {
 		return self.binarySearch (using: element.comparator);
 	}
@@ -0,0 +1,82 @@
+//
+//  CPCDayCellStatePlanes.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/// States of all day cells of a month grid, stored as one bit plane per bit of compressed state index.
+///
+/// Bit `n` of every plane describes `n`-th grid cell (counting row by row), so a grid of up to 64 cells
+/// is described by three words, and cells that share a state are found with a few bitwise operations.
+internal struct CPCDayCellStatePlanes {
+	/// Set of grid cells; bit `n` stands for `n`-th cell.
+	internal typealias Cells = UInt64;
+	
+	/// Planes of 1st and 2nd bits (background state) and 3rd bit ("is today" flag) of compressed state indices.
+	private let planes: (Cells, Cells, Cells);
+	
+	/// Creates state planes from sets of cells that have specific state flags.
+	///
+	/// Disabled cells are never selected or highlighted, selected cells are never highlighted.
+	///
+	/// - Parameters:
+	///   - highlighted: Highlighted cells.
+	///   - selected: Selected cells.
+	///   - enabled: Cells that are enabled.
+	///   - today: Cells that represent current day.
+	internal init (highlighted: Cells, selected: Cells, enabled: Cells, today: Cells) {
+		let disabled = ~enabled, selected = selected & enabled, highlighted = highlighted & enabled & ~selected;
+		self.planes = (disabled | highlighted, disabled | selected, today);
+	}
+	
+	/// State of the cell at the given position.
+	internal subscript (cell: Int) -> CPCDayCellState {
+		let mask = 1 as Cells << cell;
+		let lowBit = (self.planes.0 & mask) != 0 ? 1 : 0, highBit = (self.planes.1 & mask) != 0 ? 2 : 0, todayBit = (self.planes.2 & mask) != 0 ? 4 : 0;
+		return CPCDayCellState (compresedIndex: lowBit | highBit | todayBit);
+	}
+	
+	/// Selects cells that are in the given state.
+	///
+	/// - Parameters:
+	///   - state: Compressible cell state.
+	///   - cells: Cells to look up.
+	/// - Returns: Subset of `cells` that have the given state.
+	internal func cells (in state: CPCDayCellState, among cells: Cells) -> Cells {
+		let index = state.compressedIndex;
+		return cells &
+			(((index & 1) != 0) ? self.planes.0 : ~self.planes.0) &
+			(((index & 2) != 0) ? self.planes.1 : ~self.planes.1) &
+			(((index & 4) != 0) ? self.planes.2 : ~self.planes.2);
+	}
+}
+
+/* internal */ extension CPCDayCellStatePlanes.Cells {
+	/// Calls a closure for positions of all set bits, in ascending order.
+	internal func forEachCell (_ body: (Int) throws -> ()) rethrows {
+		var remainingCells = self;
+		while (remainingCells != 0) {
+			try body (remainingCells.trailingZeroBitCount);
+			remainingCells &= remainingCells - 1;
+		}
+	}
+}
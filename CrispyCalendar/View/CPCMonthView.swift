@@ -75,15 +75,24 @@ open class CPCMonthView: UIControl, CPCViewProtocol {
 		}
 	}
 	
-	/// Represents subset of the given month which should be rendered by the view.
-	open var enabledRegion: CountableRange <CPCDay>? {
+	/// Days of the given month that are enabled, i.e. may be selected by user. Other days are rendered as disabled.
+	open var enabledDays = CPCDayIntervalSet.all {
 		didSet {
-			if (oldValue != self.enabledRegion) {
+			if (oldValue != self.enabledDays) {
 				self.setNeedsFullAppearanceUpdate ();
 			}
 		}
 	}
 	
+	/// Represents subset of the given month which should be rendered by the view.
+	///
+	/// - Note: Value of this property is derived from `enabledDays`; if enabled days are not contiguous, it contains their smallest enclosing range.
+	///   An unbounded side of enabled days is represented by the day containing `Date.distantPast` or `Date.distantFuture`.
+	open var enabledRegion: CountableRange <CPCDay>? {
+		get { return self.enabledDays.hull }
+		set { self.enabledDays = newValue.map { CPCDayIntervalSet ($0) } ?? .all }
+	}
+	
 	@IBInspectable open dynamic var titleFont: UIFont {
 		get { return self.effectiveAppearanceStorage.titleFont }
 		set {
@@ -423,7 +432,7 @@ open class CPCMonthView: UIControl, CPCViewProtocol {
 		}
 		
 		let firstDay = month [ordinal: firstIndex.row] [ordinal: firstIndex.column];
-		if let enabledRegion = self.enabledRegion, !enabledRegion.contains (firstDay.advanced (by: firstIndex.distance (to: index))) {
+		if !self.enabledDays.contains (firstDay.advanced (by: firstIndex.distance (to: index))) {
 			return nil;
 		} else {
 			return index;
@@ -663,7 +672,7 @@ extension CPCMonthView {
 	private func monthDidChange () {
 		self.setNeedsFullAppearanceUpdate ();
 		self.highlightedDayIndex = nil;
-		self.enabledRegion = nil;
+		self.enabledDays = .all;
 		self.selectionHandler = self.selectionHandler.clearingSelection ();
 	}
 	
@@ -36,96 +36,8 @@ import UIKit
 	fileprivate static let anyTop: UIRectCorner = [.topLeft, .topRight];
 }
 
-/* internal */ extension DateFormatter {
-	internal static func eraseCachedFormatters (calendar: CPCCalendarWrapper) {
-		self.availableFormatters.withMutableStoredValue { $0 = $0.filter { $0.key.calendarWrapper !== calendar } };
-	}
-}
-
-/* fileprivate */ extension DateFormatter {
-	private struct CacheKey: Hashable {
-		fileprivate unowned let calendarWrapper: CPCCalendarWrapper;
-		private let dateFormat: String;
-		
-		fileprivate static func == (lhs: CacheKey, rhs: CacheKey) -> Bool {
-			return (lhs.calendarWrapper === rhs.calendarWrapper) && (lhs.dateFormat == rhs.dateFormat);
-		}
-		
-		fileprivate init (_ calendarWrapper: CPCCalendarWrapper, _ dateFormat: String) {
-			self.calendarWrapper = calendarWrapper;
-			self.dateFormat = dateFormat;
-		}
-		
-#if swift(>=4.2)
-		fileprivate func hash (into hasher: inout Hasher) {
-			hasher.combine (self.calendarWrapper);
-			hasher.combine (self.dateFormat);
-		}
-#else
-		fileprivate var hashValue: Int {
-			return self.calendarWrapper.hashValue &* 13 &+ self.dateFormat.hashValue &* 19;
-		}
-#endif
-	}
-	
-	private static var availableFormatters = UnfairThreadsafeStorage ([CacheKey: [DateFormatter]] ());
-	
-	private static func availableFormatter (for month: CPCMonth, format: String) -> DateFormatter? {
-		return self.availableFormatters.withMutableStoredValue {
-			let cacheKey = CacheKey (month.calendarWrapper, format);
-			guard var available = $0 [cacheKey], !available.isEmpty else {
-				return nil;
-			}
-			let result = available.removeLast ();
-			$0 [cacheKey] = available;
-			return result;
-		};
-	}
-	
-	fileprivate static func dequeueFormatter (for month: CPCMonth, format: String) -> DateFormatter {
-		if let reusedFormatter = self.availableFormatter (for: month, format: format) {
-			return reusedFormatter;
-		}
-		
-		let dateFormatter = DateFormatter ();
-		dateFormatter.calendar = month.calendar;
-		dateFormatter.locale = month.calendar.locale;
-		dateFormatter.dateFormat = format;
-		dateFormatter.formattingContext = .standalone;
-		return dateFormatter;
-	}
-
-	fileprivate static func dequeueFormatter (for month: CPCMonth, dateFormatTemplate template: String) -> DateFormatter {
-		return self.dequeueFormatter (for: month, format: DateFormatter.dateFormat (fromTemplate: template, options: 0, locale: month.calendar.locale) ?? template);
-	}
-	
-	fileprivate static func makeReusable (_ formatters: [DateFormatter], wrapper: CPCCalendarWrapper) {
-		DateFormatter.availableFormatters.withMutableStoredValue {
-			for formatter in formatters {
-				formatter.makeReusableUnlocked (&$0, wrapper: wrapper);
-			}
-		};
-	}
-
-	fileprivate func makeReusable (wrapper: CPCCalendarWrapper) {
-		DateFormatter.availableFormatters.withMutableStoredValue {
-			self.makeReusableUnlocked (&$0, wrapper: wrapper);
-		};
-	}
-	
-	private func makeReusableUnlocked (_ cache: inout [CacheKey: [DateFormatter]], wrapper: CPCCalendarWrapper) {
-		let cacheKey = CacheKey (wrapper, self.dateFormat), value = [self];
-		if let formatters = cache [cacheKey] {
-			cache [cacheKey] = formatters + value;
-		} else {
-			cache [cacheKey] = value;
-		}
-	}
-}
-
 internal protocol CPCMonthViewRedrawContext {
 	/// Runs a redraw context
-	/// Note: Redraw contexts are designed to be one-shot (e. g. DateFormatters are internally reused), so calling run () twice may lead to unexpected behaviour.
 	func run ();
 }
 
@@ -136,7 +48,7 @@ internal protocol CPCMonthViewRedrawContext {
 		fileprivate let month: CPCMonth;
 		fileprivate let clearingContext: ClearingContext?;
 		
-		private let formatter: DateFormatter;
+		private let title: String;
 		private let titleContentFrame: CGRect;
 		private let titleAttributes: [NSAttributedString.Key: Any];
 	}
@@ -144,19 +56,56 @@ internal protocol CPCMonthViewRedrawContext {
 	fileprivate struct GridRedrawContext {
 		private struct AffectedIndices {
 			fileprivate let affected: CellIndices;
-			fileprivate let highlighted: CellIndex?;
-			fileprivate let selected: CellIndices?;
-			fileprivate let enabled: CellIndices?;
-			fileprivate let allCellsDisabled: Bool;
+			fileprivate let cells: CPCDayCellStatePlanes.Cells;
+			fileprivate let states: CPCDayCellStatePlanes;
 		};
 		
+		/// Days of all grid cells, calculated in a single pass.
+		private struct GridDays {
+			fileprivate let columnsCount: Int;
+			
+			private let calendar: CPCCalendarWrapper;
+			private let backingValues: ContiguousArray <CPCDay.BackingStorage>;
+			private let positions: CPCMonth.GridDayPositions;
+			
+			/// Cells that belong to the month itself.
+			fileprivate var monthCells: CPCDayCellStatePlanes.Cells {
+				return self.positions.monthPositions;
+			}
+			
+			fileprivate init (_ month: CPCMonth) {
+				var backingValues = ContiguousArray <CPCDay.BackingStorage> ();
+				month.appendGridDayBackingValues (to: &backingValues);
+				self.calendar = month.calendarWrapper;
+				self.columnsCount = month.first?.count ?? 0;
+				self.positions = CPCMonth.GridDayPositions (of: month.backingValue, gridDays: backingValues);
+				self.backingValues = backingValues;
+			}
+			
+			fileprivate subscript (index: CellIndex) -> CPCDay {
+				return CPCDay (backedBy: self.backingValues [self.position (of: index)], calendar: self.calendar);
+			}
+			
+			fileprivate func position (of index: CellIndex) -> Int {
+				return index.row * self.columnsCount + index.column;
+			}
+			
+			/// Converts day bitmap of the month to the set of grid cells.
+			///
+			/// The first cell of the month holds its first day, which is not day 1 if an era starts in the middle of the month.
+			fileprivate func cells (ofDays dayBitmap: CPCDaySet.Bitmap) -> CPCDayCellStatePlanes.Cells {
+				return self.positions.positions (ofDays: dayBitmap);
+			}
+		}
+		
 		fileprivate let month: CPCMonth;
 		fileprivate let clearingContext: ClearingContext?;
 		
 		private let backgroundColor: UIColor?;
 		private let layout: Layout;
 		private let cellIndices: AffectedIndices;
-		private let dayFormatter: DateFormatter;
+		private let days: GridDays;
+		private let strings: CPCCalendarStringTable;
 		private let separatorColor: UIColor;
 		private let drawLeadingSeparator: Bool;
 		private let drawTrailingSeparator: Bool;
@@ -224,7 +173,6 @@ internal protocol CPCMonthViewRedrawContext {
 }
 
 private protocol CPCMonthViewRedrawContextImpl: CPCMonthViewRedrawContext {
-	var reusableFormatters: [DateFormatter] { get };
 	var month: CPCMonth { get };
 	var clearingContext: CPCMonthView.ClearingContext? { get };
 	
@@ -245,15 +193,10 @@ extension CPCMonthViewRedrawContextImpl {
 		}
 		self.clearingContext?.run (context: context);
 		self.run (context: context);
-		DateFormatter.makeReusable (self.reusableFormatters, wrapper: self.month.calendarWrapper);
 	}
 }
 
 extension CPCMonthView.TitleRedrawContext: CPCMonthViewRedrawContextImpl {
-	fileprivate var reusableFormatters: [DateFormatter] {
-		return [self.formatter];
-	}
-	
 	fileprivate init? (redrawing rect: CGRect, of month: CPCMonth, in view: CPCMonthView) {
 		guard let layout = view.layout, let titleFrame = layout.titleFrame, rect.intersects (titleFrame) else {
 			return nil;
@@ -262,7 +205,7 @@ extension CPCMonthView.TitleRedrawContext: CPCMonthViewRedrawContextImpl {
 		self.month = month;
 		self.titleContentFrame = layout.titleContentFrame;
 		self.clearingContext = CPCMonthView.TitleRedrawContext.makeClearingContext (for: titleFrame, ifNeededIn: view);
-		self.formatter = DateFormatter.dequeueFormatter (for: month, format: view.titleStyle.rawValue);
+		self.title = month.calendarWrapper.stringTable.title (of: month, format: view.titleStyle.rawValue);
 		self.titleAttributes = [
 			.font: view.effectiveTitleFont,
 			.foregroundColor: view.titleColor,
@@ -271,7 +214,7 @@ extension CPCMonthView.TitleRedrawContext: CPCMonthViewRedrawContextImpl {
 	}
 	
 	fileprivate func run (context ctx: CGContext) {
-		NSAttributedString (string: self.formatter.string (from: self.month.start), attributes: self.titleAttributes).draw (in: self.titleContentFrame);
+		NSAttributedString (string: self.title, attributes: self.titleAttributes).draw (in: self.titleContentFrame);
 	}
 }
 
@@ -292,6 +235,7 @@ extension CPCMonthView.GridRedrawContext: CPCMonthViewRedrawContextImpl {
 	private typealias CellIndex = CPCMonthView.CellIndex;
 	private typealias CellIndices = CPCMonthView.CellIndices;
 	private typealias DayCellState = CPCMonthView.DayCellState;
+	private typealias Cells = CPCDayCellStatePlanes.Cells;
 	private typealias GridRedrawContext = CPCMonthView.GridRedrawContext;
 	
 	private struct DayCellRenderingContext: CPCDayCellRenderingContext {
@@ -303,25 +247,15 @@ extension CPCMonthView.GridRedrawContext: CPCMonthViewRedrawContextImpl {
 		
 		fileprivate let graphicsContext: CGContext;
 		fileprivate let day: CPCDay;
+		fileprivate let state: CPCDayCellState;
+		fileprivate let backgroundColor: UIColor?;
+		fileprivate let titleAttributes: NSDictionary;
 
-		fileprivate var state: CPCDayCellState {
-			return self.parent.dayCellState (for: self.day, at: self.cellIndex);
-		}
-		fileprivate var backgroundColor: UIColor? {
-			return self.parent.cellBackgroundColorGetter (self.state);
-		}
 		fileprivate var frame: CGRect {
 			return self.parent.layout.cellFrames [self.cellIndex];
 		}
 		fileprivate var title: NSString {
-			return self.parent.dayFormatter.string (from: self.day.start) as NSString;
-		}
-		fileprivate var titleAttributes: NSDictionary {
-			return NSDictionary (
-				objects: [self.parent.cellTextColorGetter (self.state) ?? UIColor.clear, self.parent.cellTitleFont, NSParagraphStyle.dayCellTitleStyle],
-				forKeys: DayCellRenderingContext.titleAttributesKeys,
-				count: DayCellRenderingContext.titleAttributesKeys.count
-			);
+			return self.parent.strings.dayNumber (of: self.day) as NSString;
 		}
 		fileprivate var titleFrame: CGRect {
 			let frame = self.frame, halfSeparatorWidth = self.parent.layout.separatorWidth / 2.0;
@@ -331,15 +265,33 @@ extension CPCMonthView.GridRedrawContext: CPCMonthViewRedrawContextImpl {
 		private let parent: GridRedrawContext;
 		private let cellIndex: CellIndex;
 		
-		fileprivate init (_ parent: GridRedrawContext, cellIndex: CellIndex, graphicsContext: CGContext) {
+		fileprivate init (_ parent: GridRedrawContext, cellIndex: CellIndex, attributes: StateAttributes, graphicsContext: CGContext) {
 			self.parent = parent;
 			self.cellIndex = cellIndex;
 			self.graphicsContext = graphicsContext;
-			self.day = parent.month [ordinal: cellIndex.row] [ordinal: cellIndex.column];
+			self.day = parent.days [cellIndex];
+			(self.state, self.backgroundColor, self.titleAttributes) = (attributes.state, attributes.backgroundColor, attributes.titleAttributes);
+		}
+	}
+	
+	/// Rendering attributes that are shared by all cells in the same state.
+	private struct StateAttributes {
+		fileprivate let state: CPCDayCellState;
+		fileprivate let backgroundColor: UIColor?;
+		fileprivate let titleAttributes: NSDictionary;
+		
+		fileprivate init (_ state: CPCDayCellState, parent: GridRedrawContext) {
+			self.state = state;
+			self.backgroundColor = parent.cellBackgroundColorGetter (state);
+			self.titleAttributes = NSDictionary (
+				objects: [parent.cellTextColorGetter (state) ?? UIColor.clear, parent.cellTitleFont, NSParagraphStyle.dayCellTitleStyle],
+				forKeys: DayCellRenderingContext.titleAttributesKeys,
+				count: DayCellRenderingContext.titleAttributesKeys.count
+			);
 		}
 	}
 	
-	private static func calculateAffectedIndices (of view: CPCMonthView, in rect: CGRect, for month: CPCMonth, using layout: Layout) -> AffectedIndices? {
+	private static func calculateAffectedIndices (of view: CPCMonthView, in rect: CGRect, for month: CPCMonth, days: GridDays, using layout: Layout) -> AffectedIndices? {
 		let rect = rect.intersection (layout.gridFrame), isContentsFlipped = view.isContentsFlippedHorizontally;
 		guard
 			!rect.isNull,
@@ -350,34 +302,39 @@ extension CPCMonthView.GridRedrawContext: CPCMonthViewRedrawContextImpl {
 			return nil;
 		}
 		
-		let highlighted: CellIndex?;
-		if let viewHighlightedIdx = view.highlightedDayIndex, affected.rows ~= viewHighlightedIdx.row, affected.columns ~= viewHighlightedIdx.column {
-			highlighted = affected.convert (index: viewHighlightedIdx, from: layout.cellFrames.indices);
-		} else {
-			highlighted = nil;
+		let columnsCount = days.columnsCount, rowCells = ((1 as Cells) << affected.columns.count - 1) << affected.columns.lowerBound;
+		let monthCells = days.monthCells;
+		var cells = 0 as Cells;
+		for row in affected.rows {
+			cells |= rowCells << (row * columnsCount);
 		}
+		cells &= monthCells;
 		
-		let selection = view.selection;
-		let selected = (selection.clamped (to: month).isEmpty ? nil : affected.indices { selection.isDaySelected (month [ordinal: $0.row] [ordinal: $0.column]) });
+		let highlighted = view.highlightedDayIndex.map { (1 as Cells) << days.position (of: $0) } ?? 0;
+		let selected = days.cells (ofDays: view.selection.selectedDaysBitmap (of: month));
+		let enabled = days.cells (ofDays: view.enabledDays.dayBitmap (of: month));
+		let today = CPCDay.today (using: month.calendarWrapper), todayCells: Cells;
+		if (today.containingMonth == month) {
+			todayCells = days.cells (ofDays: 1 << (today.backingValue.day - 1));
+		} else {
+			todayCells = 0;
+		}
 		
-		let enabled: CellIndices?, allCellsDisabled: Bool;
-		if let enabledRegion = view.enabledRegion {
-			enabled = affected.indices { enabledRegion.contains (month [ordinal: $0.row] [ordinal: $0.column]) };
-			allCellsDisabled = (enabled == nil);
+		let states: CPCDayCellStatePlanes;
+		if ((enabled & cells) == 0) {
+			states = CPCDayCellStatePlanes (highlighted: 0, selected: 0, enabled: 0, today: 0);
 		} else {
-			enabled = nil;
-			allCellsDisabled = false;
+			states = CPCDayCellStatePlanes (highlighted: highlighted, selected: selected, enabled: enabled, today: todayCells);
 		}
-
-		return AffectedIndices (affected: affected, highlighted: highlighted, selected: selected, enabled: enabled, allCellsDisabled: allCellsDisabled);
+		return AffectedIndices (affected: affected, cells: cells, states: states);
 	}
 	
-	fileprivate var reusableFormatters: [DateFormatter] {
-		return [self.dayFormatter];
-	}
-
 	fileprivate init? (redrawing rect: CGRect, of month: CPCMonth, in view: CPCMonthView) {
-		guard let layout = view.layout, let indices = GridRedrawContext.calculateAffectedIndices (of: view, in: rect, for: month, using: layout) else {
+		guard let layout = view.layout else {
+			return nil;
+		}
+		let days = GridDays (month);
+		guard let indices = GridRedrawContext.calculateAffectedIndices (of: view, in: rect, for: month, days: days, using: layout) else {
 			return nil;
 		}
 		
@@ -385,6 +342,7 @@ extension CPCMonthView.GridRedrawContext: CPCMonthViewRedrawContextImpl {
 		self.month = month;
 		self.layout = layout;
 		self.cellIndices = indices;
+		self.days = days;
 		self.cellRenderer = view.cellRenderer;
 		self.separatorColor = view.separatorColor;
 		self.backgroundColor = view.backgroundColor;
@@ -395,7 +353,7 @@ extension CPCMonthView.GridRedrawContext: CPCMonthViewRedrawContextImpl {
 		self.cellTextColorGetter = { view.effectiveAppearanceStorage.cellTextColors [$0] };
 		self.cellBackgroundColorGetter = { view.effectiveAppearanceStorage.cellBackgroundColors [$0] };
 
-		self.dayFormatter = DateFormatter.dequeueFormatter (for: month, dateFormatTemplate: "d");
+		self.strings = month.calendarWrapper.stringTable;
 		self.cellTitleHeight = dayCellFont.lineHeight.rounded (.up, scale: layout.scale);
 	}
 		
@@ -428,9 +386,18 @@ extension CPCMonthView.GridRedrawContext: CPCMonthViewRedrawContextImpl {
 		} else {
 			ctx.clear (frame);
 		}
-		for index in self.cellIndices.affected {
-			let renderingContext = DayCellRenderingContext (self, cellIndex: index, graphicsContext: ctx);
-			self.cellRenderer.drawCell (in: renderingContext);
+		let affected = self.cellIndices.affected, columnsCount = self.days.columnsCount;
+		for state in CPCDayCellState.allCases {
+			let cells = self.cellIndices.states.cells (in: state, among: self.cellIndices.cells);
+			guard (cells != 0) else {
+				continue;
+			}
+			
+			let attributes = StateAttributes (state, parent: self);
+			cells.forEachCell {
+				let renderingContext = DayCellRenderingContext (self, cellIndex: affected.index (forRow: $0 / columnsCount, column: $0 % columnsCount), attributes: attributes, graphicsContext: ctx);
+				self.cellRenderer.drawCell (in: renderingContext);
+			};
 		}
 		
 		let verticalSeparatorIndexes = layout.verticalSeparatorIndexes (for: allIndices.columns, includeLeading: self.drawLeadingSeparator, includeTrailing: self.drawTrailingSeparator);
@@ -449,25 +416,6 @@ extension CPCMonthView.GridRedrawContext: CPCMonthViewRedrawContextImpl {
 		ctx.setLineWidth (layout.separatorWidth);
 		ctx.strokeLineSegments (between: separatorPoints);
 	}
-	
-	private func dayCellState (for day: CPCDay, at index: CellIndex) -> DayCellState {
-		guard !self.cellIndices.allCellsDisabled else {
-			return .disabled;
-		}
-		
-		var result: DayCellState = [];
-		if (day == .today (using: day.calendarWrapper)) {
-			result.formUnion (.isToday);
-		}
-		if let enabledIndices = self.cellIndices.enabled, !enabledIndices.contains (index) {
-			result.formUnion (.disabled);
-		} else if let selectedIndices = self.cellIndices.selected, selectedIndices.contains (index) {
-			result.formUnion (.selected);
-		} else if (self.cellIndices.highlighted == index) {
-			result.formUnion (.highlighted);
-		}
-		return result;
-	}
 }
 
 /* fileprivate */ extension NSParagraphStyle {
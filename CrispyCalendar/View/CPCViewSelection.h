@@ -34,6 +34,7 @@ NS_REFINED_FOR_SWIFT
 @property (nonatomic, readonly, nullable) NSDateInterval *datesInterval;
 @property (nonatomic, readonly, nullable) NSSet <NSDate *> *unorderedDates;
 @property (nonatomic, readonly, nullable) NSOrderedSet <NSDate *> *orderedDates;
+@property (nonatomic, readonly, nullable) id representedValue;
 
 + (instancetype) nullSelection;
 
@@ -43,6 +44,7 @@ NS_REFINED_FOR_SWIFT
 - (instancetype) initWithSingleDay: (NSDate *__nullable) day calendar: (NSCalendar *__nullable) calendar;
 - (instancetype) initWithDatesRange: (NSDateInterval *) datesInterval calendar: (NSCalendar *) calendar;
 - (instancetype) initWithUnorderedDatesSet: (NSSet <NSDate *> *) datesSet calendar: (NSCalendar *__nullable) calendar;
+- (instancetype) initWithUnorderedDatesProvider: (NSSet <NSDate *> *(^)(void)) datesProvider representedValue: (id __nullable) representedValue calendar: (NSCalendar *__nullable) calendar;
 - (instancetype) initWithOrderedDatesSet: (NSOrderedSet <NSDate *> *) datesSet calendar: (NSCalendar *__nullable) calendar;
 
 @end
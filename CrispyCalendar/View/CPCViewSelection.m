@@ -26,6 +26,9 @@
 @interface CPCViewSelection () {
 	NSCalendar *_calendar;
 	id _value;
+	id _representedValue;
+	NSSet <NSDate *> *(^_unorderedDatesProvider)(void);
+	NSSet <NSDate *> *_providedUnorderedDates;
 }
 
 - (instancetype) initWithValue: (id) value calendar: (NSCalendar *) calendar NS_DESIGNATED_INITIALIZER;
@@ -56,7 +59,16 @@
 }
 
 - (NSSet <NSDate *> *) unorderedDates {
-	return [_value isKindOfClass:[NSSet <NSDate *> class]] ? _value : nil;
+	if (!_unorderedDatesProvider) {
+		return [_value isKindOfClass:[NSSet <NSDate *> class]] ? _value : nil;
+	}
+	
+	@synchronized (self) {
+		if (!_providedUnorderedDates) {
+			_providedUnorderedDates = _unorderedDatesProvider ();
+		}
+		return _providedUnorderedDates;
+	}
 }
 
 - (NSOrderedSet <NSDate *> *) orderedDates {
@@ -75,10 +87,22 @@
 	return [self initWithValue:datesSet calendar:calendar];
 }
 
+- (instancetype) initWithUnorderedDatesProvider: (NSSet <NSDate *> *(^)(void)) datesProvider representedValue: (id) representedValue calendar: (NSCalendar *) calendar {
+	if (self = [self initWithValue:nil calendar:calendar]) {
+		_unorderedDatesProvider = [datesProvider copy];
+		_representedValue = representedValue;
+	}
+	return self;
+}
+
 - (instancetype) initWithOrderedDatesSet: (NSOrderedSet <NSDate *> *) datesSet calendar: (NSCalendar *) calendar {
 	return [self initWithValue:datesSet calendar:calendar];
 }
 
+- (id) representedValue {
+	return _representedValue;
+}
+
 - (instancetype) initWithValue: (id) value calendar: (NSCalendar *) calendar {
 	if (self = [super init]) {
 		_calendar = calendar;
@@ -33,7 +33,9 @@ public enum CPCViewSelection: Equatable {
 	/// Range of dates selection mode; associated value holds currently selected days range (possibly empty).
 	case range (CountableRange <CPCDay>);
 	/// Arbitrary set of dates selection mode; associated value holds unordered collection of selected dates (possibly empty).
-	case unordered (Set <CPCDay>);
+	///
+	/// - Note: Associated value used to be `Set <CPCDay>`; existing sets may be converted with `CPCDaySet (days)`.
+	case unordered (CPCDaySet);
 	/// Arbitrary array of dates selection mode; associated value holds collection of selected dates (possibly empty) ordered the same way that user did pick them.
 	case ordered ([CPCDay]);
 }
@@ -110,7 +112,7 @@ extension CPCViewSelection: ReferenceConvertible {
 		case .range (let range):
 			return __CPCViewSelection (datesRange: DateInterval (start: range.lowerBound.start, end: range.upperBound.start), calendar: range.lowerBound.calendar);
 		case .unordered (let days):
-			return __CPCViewSelection (unorderedDatesSet: Set (days.map { $0.start }), calendar: days.first?.calendar);
+			return __CPCViewSelection (unorderedDatesProvider: { Set (days.map { $0.start }) }, representedValue: days, calendar: days.first?.calendar);
 		case .ordered (let days):
 			return __CPCViewSelection (orderedDatesSet: NSOrderedSet (array: days.map { $0.start }), calendar: days.first?.calendar);
 		}
@@ -120,11 +122,14 @@ extension CPCViewSelection: ReferenceConvertible {
 		guard !source.isNull else {
 			return result = CPCViewSelection.none;
 		}
+		if let days = source.representedValue as? CPCDaySet {
+			return result = .unordered (days);
+		}
 		if let calendar = source.calendar {
 			if let orderedDates = source.orderedDates {
 				result = .ordered (orderedDates.map { CPCDay (containing: $0 as! Date, calendar: calendar) });
 			} else if let unorderedDates = source.unorderedDates {
-				result = .unordered (Set (unorderedDates.map { CPCDay (containing: $0, calendar: calendar) }));
+				result = .unordered (CPCDaySet (unorderedDates.map { CPCDay (containing: $0, calendar: calendar) }));
 			} else if let datesInterval = source.datesInterval {
 				result = .range (CPCDay (containing: datesInterval.start, calendar: calendar) ..< CPCDay (containing: datesInterval.end, calendar: calendar));
 			} else {
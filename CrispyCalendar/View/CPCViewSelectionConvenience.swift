@@ -74,7 +74,7 @@ import Foundation
 			}
 			return Set (selectedDaysArray);
 		case .unordered (let selectedDays):
-			return selectedDays;
+			return Set (selectedDays);
 		case .ordered (let selectedDays):
 			return Set (selectedDays);
 		}
@@ -107,6 +107,69 @@ import Foundation
 			return .ordered (days.filter { datesRange.contains ($0) });
 		}
 	}
+	
+	/// Returns a selection of the same kind containing selected days converted to another calendar.
+	///
+	/// - Parameter calendar: Calendar to convert selected days to.
+	public func converted (to calendar: Calendar) -> CPCViewSelection {
+		return self.converted (to: calendar.wrapped ());
+	}
+	
+	/// Returns a selection of the same kind containing selected days converted to another calendar.
+	///
+	/// - Parameter calendar: Calendar to convert selected days to.
+	internal func converted (to calendar: CPCCalendarWrapper) -> CPCViewSelection {
+		switch (self) {
+		case .none, .single (nil):
+			return self;
+		case .single (.some (let day)):
+			var reprojection = CPCCalendarUnitsReprojection (from: day.calendarWrapper, to: calendar);
+			return .single (reprojection.day (day));
+		case .range (let days):
+			var reprojection = CPCCalendarUnitsReprojection (from: days.lowerBound.calendarWrapper, to: calendar);
+			return .range (reprojection.dayRange (days));
+		case .unordered (let days):
+			return .unordered (days.converted (to: calendar));
+		case .ordered (let days):
+			guard let firstDay = days.first else {
+				return self;
+			}
+			var reprojection = CPCCalendarUnitsReprojection (from: firstDay.calendarWrapper, to: calendar);
+			return .ordered (reprojection.days (days));
+		}
+	}
+	
+	/// Check whether the selection contains at least one day of a month.
+	///
+	/// - Parameter month: Month to look up.
+	/// - Returns: `true` if some day of the given month is selected; otherwise, `false`.
+	internal func containsDays (of month: CPCMonth) -> Bool {
+		switch (self) {
+		case .unordered (let days):
+			return days.containsDays (of: month);
+		default:
+			return !self.clamped (to: month).isEmpty;
+		}
+	}
+	
+	/// Returns bitmap of selected days of a month.
+	///
+	/// - Parameter month: Month to look up.
+	/// - Returns: Day bitmap of the month; bit `n` stands for `n + 1`-th day of the month.
+	internal func selectedDaysBitmap (of month: CPCMonth) -> CPCDaySet.Bitmap {
+		switch (self) {
+		case .none, .single (nil):
+			return 0;
+		case .single (.some (let day)):
+			return CPCDaySet ([day]).bitmap (of: month);
+		case .range (let days):
+			return month.dayBitmap (covering: days);
+		case .unordered (let days):
+			return days.bitmap (of: month);
+		case .ordered (let days):
+			return CPCDaySet (days).bitmap (of: month);
+		}
+	}
 }
 
 /* public */ extension CPCViewSelection {
@@ -144,7 +207,7 @@ import Foundation
 			if let contiguousRange = range.contiguousUnion (day) {
 				lhs = .range (contiguousRange);
 			} else {
-				lhs = .unordered (Set ([day] + range));
+				lhs = .unordered (CPCDaySet ([day] + range));
 			}
 		
 		case (.single (.some /*(let day)*/), .range /*(let range)*/):
@@ -154,7 +217,7 @@ import Foundation
 			if let contiguousRange = range1.contiguousUnion (range2) {
 				lhs = .range (contiguousRange);
 			} else {
-				lhs = .unordered (Set (Array (range1) + range2));
+				lhs = .unordered (CPCDaySet (Array (range1) + range2));
 			}
 			
 		case (.range (let range), .unordered (let days)):
@@ -237,7 +300,7 @@ import Foundation
 				} else if range1.upperBound == range2.upperBound {
 					lhs = .range (range1.lowerBound ..< range2.lowerBound);
 				} else {
-					lhs = .unordered (Set (Array (range1.lowerBound ..< range2.lowerBound) + (range2.upperBound ..< range1.upperBound)));
+					lhs = .unordered (CPCDaySet (Array (range1.lowerBound ..< range2.lowerBound) + (range2.upperBound ..< range1.upperBound)));
 				}
 			}
 			
@@ -250,10 +313,10 @@ import Foundation
 			} else if (day == range.lowerBound) {
 				lhs = .range (day.next ..< range.upperBound);
 			} else {
-				lhs = .unordered (Set (range.filter { $0 != day }));
+				lhs = .unordered (CPCDaySet (range.filter { $0 != day }));
 			}
 		case (.range (let range), .unordered (let days)):
-			lhs = .unordered (Set (range).subtracting (days))
+			lhs = .unordered (CPCDaySet (range).subtracting (days))
 		case (.range (let range), .ordered (let days)):
 			lhs = .ordered (range.filter { !days.contains ($0) });
 
@@ -343,7 +406,7 @@ extension CPCViewProtocol {
 	///
 	/// - Parameter unordered: Days to append.
 	public func select <C> (_ unordered: C) where C: Collection, C: SetAlgebra, C.Element == CPCDay {
-		self.selection += .unordered (Set (unordered));
+		self.selection += .unordered (CPCDaySet (unordered));
 	}
 	
 	/// Removes a single day from the specified selection.
@@ -385,6 +448,6 @@ extension CPCViewProtocol {
 	///
 	/// - Parameter ordered: Days to append.
 	public func deselect <C> (_ unordered: C) where C: Collection, C: SetAlgebra, C.Element == CPCDay {
-		self.selection -= .unordered (Set (unordered));
+		self.selection -= .unordered (CPCDaySet (unordered));
 	}
 }
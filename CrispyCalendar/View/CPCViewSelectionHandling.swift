@@ -137,18 +137,18 @@ extension CPCViewSelectionHandler {
 				return .unordered (self.selectedDays);
 			}
 			
-			private var selectedDays: Set <CPCDay>;
+			private var selectedDays: CPCDaySet;
 
 			fileprivate init () {
 				self.init ([]);
 			}
 
-			fileprivate init (_ selectedDays: Set <CPCDay> = Set ()) {
+			fileprivate init (_ selectedDays: CPCDaySet = CPCDaySet ()) {
 				self.selectedDays = selectedDays;
 			}
 
 			fileprivate func handleTap (day: CPCDay) -> CPCViewSelectionHandlerProtocol? {
-				return Unordered (self.selectedDays.contains (day) ? self.selectedDays.filter { $0 != day } : self.selectedDays.union (day));
+				return Unordered (self.selectedDays.contains (day) ? self.selectedDays.subtracting (day) : self.selectedDays.union (day));
 			}
 		}
 		
@@ -0,0 +1,120 @@
+//
+//  CPCViewSelectionSerialization.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import Foundation
+
+/* fileprivate */ extension CPCViewSelection {
+	fileprivate enum Kind: UInt8 {
+		case none;
+		case singleEmpty;
+		case single;
+		case range;
+		case unordered;
+		case ordered;
+	}
+	
+	fileprivate var calendar: Calendar? {
+		switch (self) {
+		case .none, .single (nil):
+			return nil;
+		case .single (.some (let day)):
+			return day.calendar;
+		case .range (let days):
+			return days.lowerBound.calendar;
+		case .unordered (let days):
+			return days.calendarWrapper?.calendar;
+		case .ordered (let days):
+			return days.first?.calendar;
+		}
+	}
+}
+
+/* public */ extension CPCCalendarUnitsEncoder {
+	/// Writes a selection.
+	///
+	/// - Parameter selection: Selection to write.
+	public func encode (_ selection: CPCViewSelection) {
+		switch (selection) {
+		case .none:
+			self.encodeSelectionKind (CPCViewSelection.Kind.none.rawValue);
+		case .single (nil):
+			self.encodeSelectionKind (CPCViewSelection.Kind.singleEmpty.rawValue);
+		case .single (.some (let day)):
+			self.encodeSelectionKind (CPCViewSelection.Kind.single.rawValue);
+			self.encode (day);
+		case .range (let days):
+			self.encodeSelectionKind (CPCViewSelection.Kind.range.rawValue);
+			self.encode (days);
+		case .unordered (let days):
+			self.encodeSelectionKind (CPCViewSelection.Kind.unordered.rawValue);
+			self.encode (days);
+		case .ordered (let days):
+			self.encodeSelectionKind (CPCViewSelection.Kind.ordered.rawValue);
+			self.encode (days);
+		}
+	}
+}
+
+/* public */ extension CPCCalendarUnitsDecoder {
+	/// Reads a selection.
+	///
+	/// - Returns: Decoded selection.
+	public func decodeSelection () throws -> CPCViewSelection {
+		let rawKind = try self.decodeSelectionKind ();
+		guard let kind = CPCViewSelection.Kind (rawValue: rawKind) else {
+			throw Error.malformedRecord;
+		}
+		
+		switch (kind) {
+		case .none:
+			return .none;
+		case .singleEmpty:
+			return .single (nil);
+		case .single:
+			return .single (try self.decodeDay ());
+		case .range:
+			return .range (try self.decodeDayRange ());
+		case .unordered:
+			return .unordered (try self.decodeDaySet ());
+		case .ordered:
+			return .ordered (try self.decodeDays ());
+		}
+	}
+}
+
+/* public */ extension CPCViewSelection {
+	/// Returns compact binary representation of this selection.
+	///
+	/// - Parameter calendar: Calendar to store selected days in. Defaults to the calendar of selected days.
+	/// - Returns: Encoded selection, that may be decoded with `init (encodedData:)`.
+	public func encodedData (calendar: Calendar? = nil) -> Data {
+		return CPCCalendarUnitsEncoder.encodedData (calendar: calendar ?? self.calendar ?? .current) { $0.encode (self) };
+	}
+	
+	/// Creates a selection from its compact binary representation.
+	///
+	/// - Parameter data: Data returned by `encodedData (calendar:)`.
+	public init (encodedData data: Data) throws {
+		self = try CPCCalendarUnitsDecoder (data: data).decodeSelection ();
+	}
+}
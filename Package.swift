@@ -0,0 +1,64 @@
+// swift-tools-version:5.0
+//
+//  Package.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import PackageDescription
+
+/// Headless part of CrispyCalendar: calendar units model and utilities, without any UIKit views.
+///
+/// The package is used to build and benchmark the model layer on any platform that has Foundation,
+/// including Linux. Applications should keep integrating the full framework via CocoaPods or Xcode project.
+let package = Package (
+	name: "CrispyCalendar",
+	products: [
+		.library (name: "CrispyCalendar", targets: ["CrispyCalendar"]),
+		.executable (name: "CrispyCalendarBenchmarks", targets: ["CrispyCalendarBenchmarks"]),
+	],
+	targets: [
+		.target (
+			name: "CrispyCalendarCore",
+			path: "Package/CrispyCalendarCore"
+		),
+		.target (
+			name: "CrispyCalendar",
+			dependencies: ["CrispyCalendarCore"],
+			path: "CrispyCalendar",
+			exclude: [
+				"Model/CPCCalendarUnitSymbolStyle.h",
+				"Model/CPCCalendarUnitsStorage.h",
+				"Util/CPCAtomicOperations.h",
+			],
+			sources: ["Model", "Util"]
+		),
+		.target (
+			name: "CrispyCalendarBenchmarks",
+			dependencies: ["CrispyCalendar"],
+			path: "Benchmarks/CrispyCalendarBenchmarks"
+		),
+		.testTarget (
+			name: "CrispyCalendarTests",
+			dependencies: ["CrispyCalendar"],
+			path: "Tests/CrispyCalendarTests"
+		),
+	]
+);
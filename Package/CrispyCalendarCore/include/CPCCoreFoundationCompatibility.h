@@ -0,0 +1,68 @@
+//
+//  CPCCoreFoundationCompatibility.h
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef CPCCoreFoundationCompatibility_h
+#define CPCCoreFoundationCompatibility_h
+
+/// Subset of CoreFoundation macros used by CrispyCalendar C headers, for platforms where
+/// <CoreFoundation/CFBase.h> is not importable (e.g. Swift Package Manager builds on Linux).
+
+#ifndef __has_attribute
+#define __has_attribute(x) 0
+#endif
+
+#ifndef __has_feature
+#define __has_feature(x) 0
+#endif
+
+#ifndef CF_INLINE
+#define CF_INLINE static __inline__ __attribute__ ((always_inline))
+#endif
+
+#if __has_attribute (swift_private)
+#define CF_REFINED_FOR_SWIFT __attribute__ ((swift_private))
+#else
+#define CF_REFINED_FOR_SWIFT
+#endif
+
+#if __has_attribute (swift_name)
+#define CF_SWIFT_NAME(_name) __attribute__ ((swift_name (#_name)))
+#else
+#define CF_SWIFT_NAME(_name)
+#endif
+
+#if __has_feature (attribute_availability_swift)
+#define CF_SWIFT_UNAVAILABLE(_msg) __attribute__ ((availability (swift, unavailable, message = _msg)))
+#else
+#define CF_SWIFT_UNAVAILABLE(_msg)
+#endif
+
+#if __has_feature (objc_fixed_enum) && __has_attribute (enum_extensibility)
+#define CF_ENUM(_type, _name) enum __attribute__ ((enum_extensibility (open))) _name : _type _name; enum _name : _type
+#else
+#define CF_ENUM(_type, _name) _type _name; enum
+#endif
+
+typedef signed long CFIndex;
+
+#endif /* CPCCoreFoundationCompatibility_h */
@@ -0,0 +1,81 @@
+//
+//  CalendarUnitOrderingTests.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import XCTest
+@testable import CrispyCalendar
+
+/// Checks that comparison of calendar units by ordered keys matches chronological order, including era boundaries.
+final class CalendarUnitOrderingTests: XCTestCase {
+	private static let calendarIdentifiers: [Calendar.Identifier] = [
+		.gregorian, .iso8601, .coptic, .republicOfChina, .ethiopicAmeteMihret, .ethiopicAmeteAlem, .japanese, .buddhist, .hebrew, .islamic, .persian, .chinese,
+	];
+	
+	func testDescendingFirstEraYears () {
+		let expectedIdentifiers: Set <Calendar.Identifier> = [.gregorian, .iso8601, .coptic, .republicOfChina];
+		for identifier in CalendarUnitOrderingTests.calendarIdentifiers {
+			XCTAssertEqual (self.calendar (identifier).wrapped ().hasDescendingFirstEraYears, expectedIdentifiers.contains (identifier), "\(identifier)");
+		}
+	}
+	
+	func testDaysOrderAcrossEraBoundary () {
+		for identifier in CalendarUnitOrderingTests.calendarIdentifiers {
+			let calendar = self.calendar (identifier);
+			guard let secondEraStart = calendar.date (from: DateComponents (era: 1, year: 1, month: 1, day: 1)) else {
+				continue;
+			}
+			
+			let days = (-800 ... 800).map { CPCDay (containing: secondEraStart.addingTimeInterval (Double ($0) * 86400.0 + 43200.0), calendar: calendar) };
+			for (day, nextDay) in zip (days, days.dropFirst ()) {
+				XCTAssertLessThan (day, nextDay, "\(identifier)");
+				XCTAssertFalse (nextDay < day, "\(identifier)");
+			}
+			XCTAssertEqual (days.shuffled ().sorted (), days, "\(identifier)");
+		}
+	}
+	
+	func testMonthsAndYearsOrderAcrossEraBoundary () {
+		for identifier in CalendarUnitOrderingTests.calendarIdentifiers {
+			let calendar = self.calendar (identifier);
+			guard let secondEraStart = calendar.date (from: DateComponents (era: 1, year: 1, month: 1, day: 1)) else {
+				continue;
+			}
+			
+			let month = CPCMonth (containing: secondEraStart, calendar: calendar), months = (-30 ... 30).map { month.advanced (by: $0) };
+			for (month, nextMonth) in zip (months, months.dropFirst ()) {
+				XCTAssertLessThan (month, nextMonth, "\(identifier)");
+			}
+			
+			let year = CPCYear (containing: secondEraStart, calendar: calendar), years = (-3 ... 3).map { year.advanced (by: $0) };
+			for (year, nextYear) in zip (years, years.dropFirst ()) {
+				XCTAssertLessThan (year, nextYear, "\(identifier)");
+			}
+		}
+	}
+	
+	private func calendar (_ identifier: Calendar.Identifier) -> Calendar {
+		var result = Calendar (identifier: identifier);
+		result.locale = Locale (identifier: "en_US_POSIX");
+		result.timeZone = guarantee (TimeZone (identifier: "UTC"));
+		return result;
+	}
+}
@@ -0,0 +1,99 @@
+//
+//  CalendarUnitsSerializationTests.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import XCTest
+@testable import CrispyCalendar
+
+/// Checks that encoded units are decoded back and that malformed records are rejected instead of producing invalid units.
+final class CalendarUnitsSerializationTests: XCTestCase {
+	private let calendar: Calendar = {
+		var result = Calendar (identifier: .gregorian);
+		result.locale = Locale (identifier: "en_US_POSIX");
+		result.timeZone = guarantee (TimeZone (identifier: "UTC"));
+		return result;
+	} ();
+	
+	private var firstDay: CPCDay {
+		return CPCDay (containing: Date (timeIntervalSinceReferenceDate: 0.0), calendar: self.calendar);
+	}
+	
+	func testEncodedUnitsAreDecoded () throws {
+		let days = (0 ..< 100).map { self.firstDay.advanced (by: $0 * $0 % 61) }, daySet = CPCDaySet (days);
+		let range = self.firstDay ..< self.firstDay.advanced (by: 45);
+		let data = CPCCalendarUnitsEncoder.encodedData (calendar: self.calendar) { encoder in
+			encoder.encode (days);
+			encoder.encode (daySet);
+			encoder.encode (range);
+		};
+		
+		let decoder = try CPCCalendarUnitsDecoder (data: data);
+		XCTAssertEqual (try decoder.decodeDays (), days);
+		XCTAssertEqual (try decoder.decodeDaySet (), daySet);
+		XCTAssertEqual (try decoder.decodeDayRange (), range);
+	}
+	
+	func testHugeRunIsRejected () {
+		let dayKey = self.firstDay.backingValue.orderedKey (using: self.calendar.wrapped ());
+		self.assertMalformed (record: [5] + self.varint (1) + self.delta (dayKey) + self.varint (UInt64.max >> 1) + self.varint (0)) { try $0.decodeDays () };
+		self.assertMalformed (record: [5] + self.varint (1) + self.delta (dayKey) + self.varint (31) + self.varint (0)) { try $0.decodeDays () };
+		self.assertMalformed (record: [5] + self.varint (100_000) + self.delta (dayKey) + self.varint (0) + self.varint (0)) { try $0.decodeDays () };
+	}
+	
+	func testInvalidMonthsAndDaysAreRejected () {
+		let dayKey = self.firstDay.backingValue.orderedKey (using: self.calendar.wrapped ()), monthKey = dayKey >> 8;
+		let monthBits = UInt64 (0xFF) << 8, dayBits = UInt64 (0xFF);
+		self.assertMalformed (record: [1] + self.delta (dayKey & ~monthBits)) { try $0.decodeDay () };
+		self.assertMalformed (record: [1] + self.delta ((dayKey & ~monthBits) | (UInt64 (26) << 8))) { try $0.decodeDay () };
+		self.assertMalformed (record: [1] + self.delta ((dayKey & ~dayBits) | (128 + 32))) { try $0.decodeDay () };
+		self.assertMalformed (record: [4] + self.delta (dayKey) + self.varint (UInt64.max)) { try $0.decodeDayRange () };
+		self.assertMalformed (record: [6] + self.varint (1) + self.delta (monthKey & ~0xFF) + self.varint (1) + self.varint (0)) { try $0.decodeDaySet () };
+		self.assertMalformed (record: [6] + self.varint (1) + self.delta (monthKey) + self.varint (1 << 31) + self.varint (0)) { try $0.decodeDaySet () };
+	}
+	
+	private func assertMalformed <T> (record: [UInt8], file: StaticString = #file, line: UInt = #line, decode: (CPCCalendarUnitsDecoder) throws -> T) {
+		let header = CPCCalendarUnitsEncoder.encodedData (calendar: self.calendar) { _ in };
+		do {
+			let decoder = try CPCCalendarUnitsDecoder (data: header + record);
+			_ = try decode (decoder);
+			XCTFail ("Malformed record \(record) was decoded", file: file, line: line);
+		} catch CPCCalendarUnitsDecoder.Error.malformedRecord {
+		} catch {
+			XCTFail ("Unexpected error \(error)", file: file, line: line);
+		}
+	}
+	
+	private func varint (_ value: UInt64) -> [UInt8] {
+		var result = [UInt8] (), value = value;
+		while (value >= 0x80) {
+			result.append (UInt8 (truncatingIfNeeded: value) | 0x80);
+			value >>= 7;
+		}
+		result.append (UInt8 (value));
+		return result;
+	}
+	
+	private func delta (_ key: UInt64) -> [UInt8] {
+		let delta = Int64 (bitPattern: key);
+		return self.varint (UInt64 (bitPattern: (delta << 1) ^ (delta >> 63)));
+	}
+}
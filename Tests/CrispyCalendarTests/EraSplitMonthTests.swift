@@ -0,0 +1,143 @@
+//
+//  EraSplitMonthTests.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import XCTest
+@testable import CrispyCalendar
+
+/// Checks days enumeration across an era that starts in the middle of a month (Showa 64 is followed by Heisei 1 on 1989-01-08).
+final class EraSplitMonthTests: XCTestCase {
+	private let calendar: Calendar = {
+		var result = Calendar (identifier: .japanese);
+		result.locale = Locale (identifier: "en_US_POSIX");
+		result.timeZone = guarantee (TimeZone (identifier: "UTC"));
+		return result;
+	} ();
+	
+	private var firstDayNumber: Int {
+		return self.calendar.dayNumber (of: guarantee (DateComponents (calendar: self.calendar, timeZone: self.calendar.timeZone, era: 234, year: 64, month: 1, day: 1).date));
+	}
+	
+	func testLastDayOfSplitMonth () {
+		let showaDay = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber), calendar: self.calendar);
+		let heiseiDay = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 7), calendar: self.calendar);
+		XCTAssertNotEqual (showaDay.era, heiseiDay.era);
+		XCTAssertEqual (heiseiDay.day, 8);
+		XCTAssertEqual (CPCDayBackingStorageIterator.lastDayOfMonth (containing: showaDay, calendar: self.calendar), 7);
+		XCTAssertEqual (CPCDayBackingStorageIterator.lastDayOfMonth (containing: heiseiDay, calendar: self.calendar), 31);
+	}
+	
+	func testFirstDayOfSplitMonth () {
+		let showaDay = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 3), calendar: self.calendar);
+		let heiseiDay = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 20), calendar: self.calendar);
+		XCTAssertEqual (CPCDayBackingStorageIterator.firstDayOfMonth (containing: showaDay, calendar: self.calendar), 1);
+		XCTAssertEqual (CPCDayBackingStorageIterator.firstDayOfMonth (containing: heiseiDay, calendar: self.calendar), 8);
+	}
+	
+	func testDaysRangeEnumerationTerminates () {
+		let calendar = self.calendar.wrapped ();
+		let first = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber - 3), calendar: self.calendar);
+		let last = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 10), calendar: self.calendar);
+		var days = ContiguousArray <CPCDay.BackingStorage> ();
+		CPCDay.BackingStorage.appendDays (from: last, to: first, calendar: calendar, to: &days);
+		XCTAssertTrue (days.isEmpty);
+		
+		CPCDay.BackingStorage.appendDays (from: first, to: last, calendar: calendar, to: &days);
+		XCTAssertEqual (days.count, 13);
+		XCTAssertEqual (days.last?.day, 10);
+		
+		// Heisei 1 starts on January 8, so January 3 of Heisei 1 is never produced by iteration.
+		let missingDay = CPCDay.BackingStorage (era: last.era, year: last.year, month: last.month, day: 3);
+		days.removeAll ();
+		CPCDay.BackingStorage.appendDays (from: first, to: missingDay, calendar: calendar, to: &days);
+		XCTAssertLessThanOrEqual (days.count, 13);
+	}
+	
+	func testDayBitmapOfSplitMonth () {
+		let showaMonth = CPCMonth (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber), calendar: self.calendar);
+		let heiseiMonth = CPCMonth (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 7), calendar: self.calendar);
+		let days = CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber - 40), calendar: self.calendar) ..< CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 60), calendar: self.calendar);
+		XCTAssertEqual (showaMonth.dayBitmap (covering: days), 0x7F);
+		XCTAssertEqual (heiseiMonth.dayBitmap (covering: days), 0x7FFF_FF80);
+		
+		let lastHeiseiDays = CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 29), calendar: self.calendar) ..< days.upperBound;
+		XCTAssertEqual (heiseiMonth.dayBitmap (covering: lastHeiseiDays), 0x6000_0000);
+	}
+	
+	func testIntervalSetDayBitmapOfSplitMonth () {
+		let showaMonth = CPCMonth (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber), calendar: self.calendar);
+		let heiseiMonth = CPCMonth (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 7), calendar: self.calendar);
+		let firstDay = CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber - 40), calendar: self.calendar);
+		let days = firstDay ..< CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 60), calendar: self.calendar);
+		for daySet in [CPCDayIntervalSet (days), CPCDayIntervalSet (firstDay...)] {
+			XCTAssertEqual (daySet.dayBitmap (of: showaMonth), 0x7F);
+			XCTAssertEqual (daySet.dayBitmap (of: heiseiMonth), 0x7FFF_FF80);
+			XCTAssertEqual (daySet.dayBitmap (of: heiseiMonth.advanced (by: 1)), 0x0FFF_FFFF);
+		}
+		
+		let lastHeiseiDays = CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 29), calendar: self.calendar) ..< days.upperBound;
+		XCTAssertEqual (CPCDayIntervalSet (lastHeiseiDays).dayBitmap (of: heiseiMonth), 0x6000_0000);
+		XCTAssertEqual (CPCDayIntervalSet (lastHeiseiDays).dayBitmap (of: showaMonth), 0);
+	}
+	
+	func testGridPositionsOfSplitMonth () {
+		let days = CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber - 40), calendar: self.calendar) ..< CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber + 60), calendar: self.calendar);
+		for dayNumber in [self.firstDayNumber, self.firstDayNumber + 7] {
+			let month = CPCMonth (containing: self.calendar.startDate (ofDayNumber: dayNumber), calendar: self.calendar);
+			var gridDays = ContiguousArray <CPCDay.BackingStorage> ();
+			month.appendGridDayBackingValues (to: &gridDays);
+			let positions = CPCMonth.GridDayPositions (of: month.backingValue, gridDays: gridDays);
+			
+			var expectedMonthPositions = 0 as UInt64;
+			for (position, day) in gridDays.enumerated () where day.containingMonth (month.calendarWrapper) == month.backingValue {
+				expectedMonthPositions |= 1 << position;
+				XCTAssertEqual (positions.positions (ofDays: 1 << (day.day - 1)), 1 << position, "\(day)");
+			}
+			XCTAssertEqual (positions.monthPositions, expectedMonthPositions, "\(month)");
+			XCTAssertEqual (positions.positions (ofDays: month.dayBitmap (covering: days)), expectedMonthPositions, "\(month)");
+		}
+	}
+	
+	func testReprojectionAcrossSplitMonth () {
+		var gregorian = Calendar (identifier: .gregorian);
+		gregorian.timeZone = self.calendar.timeZone;
+		var reprojection = CPCCalendarUnitsReprojection (from: gregorian.wrapped (), to: self.calendar.wrapped ());
+		let firstGregorianDay = CPCDay (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber - 5), calendar: gregorian);
+		for offset in 0 ..< 40 {
+			let day = reprojection.day (firstGregorianDay.advanced (by: offset));
+			let expectedDay = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: self.firstDayNumber - 5 + offset), calendar: self.calendar);
+			XCTAssertEqual (day.backingValue, expectedDay, "Offset \(offset)");
+		}
+	}
+	
+	func testDaysEnumerationMatchesFoundation () {
+		let calendar = self.calendar.wrapped (), firstDayNumber = self.firstDayNumber - 40;
+		let first = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: firstDayNumber), calendar: self.calendar);
+		var days = ContiguousArray <CPCDay.BackingStorage> ();
+		CPCDay.BackingStorage.appendDays (startingAt: first, count: 120, calendar: calendar, to: &days);
+		for (offset, day) in days.enumerated () {
+			let expectedDay = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: firstDayNumber + offset), calendar: self.calendar);
+			XCTAssertEqual (day, expectedDay, "Day \(firstDayNumber + offset)");
+			XCTAssertEqual (day.dayNumber (using: calendar), firstDayNumber + offset, "Day \(day)");
+		}
+	}
+}
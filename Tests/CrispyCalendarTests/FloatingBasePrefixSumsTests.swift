@@ -0,0 +1,118 @@
+//
+//  FloatingBasePrefixSumsTests.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import XCTest
+@testable import CrispyCalendar
+
+/// Checks range sums and inverse prefix sum queries of `FloatingBasePrefixSums` against straightforward calculations.
+final class FloatingBasePrefixSumsTests: XCTestCase {
+	private var randomState = UInt64 (0x2545F4914F6CDD1D);
+	
+	func testUnassignedValuesAreZero () {
+		var sums = FloatingBasePrefixSums <Int> (baseOffset: -5);
+		XCTAssertEqual (sums [-5], 0);
+		XCTAssertEqual (sums.sum (of: -100 ..< 100), 0);
+		
+		sums [3] = 7;
+		XCTAssertEqual (sums [3], 7);
+		XCTAssertEqual (sums [2], 0);
+		XCTAssertEqual (sums [1_000], 0);
+		XCTAssertEqual (sums.sum (of: -100 ..< 100), 7);
+		XCTAssertEqual (sums.sum (of: 4 ..< 100), 0);
+	}
+	
+	func testSumsMatchReference () {
+		var sums = FloatingBasePrefixSums <Int> (), reference = [Int: Int] ();
+		for index in self.shuffledIndices (in: -300 ..< 300) {
+			let value = self.nextRandomValue (below: 50);
+			sums [index] = value;
+			reference [index] = value;
+		}
+		for index in self.shuffledIndices (in: -300 ..< 300).prefix (100) {
+			let value = self.nextRandomValue (below: 50);
+			sums [index] = value;
+			reference [index] = value;
+		}
+		
+		for _ in 0 ..< 2_000 {
+			let lowerBound = self.nextRandomValue (below: 700) - 350, upperBound = lowerBound + self.nextRandomValue (below: 400);
+			let expectedSum = (lowerBound ..< upperBound).reduce (0) { $0 + (reference [$1] ?? 0) };
+			XCTAssertEqual (sums.sum (of: lowerBound ..< upperBound), expectedSum, "Sum of \(lowerBound) ..< \(upperBound)");
+		}
+	}
+	
+	func testGrowthInBothDirectionsPreservesValues () {
+		var sums = FloatingBasePrefixSums <Int> ();
+		for row in 0 ..< 1_000 {
+			sums [row] = row % 7 + 1;
+			sums [-row - 1] = row % 5 + 1;
+		}
+		
+		XCTAssertTrue (sums.indices.contains (-1_000));
+		XCTAssertTrue (sums.indices.contains (999));
+		for row in 0 ..< 1_000 {
+			XCTAssertEqual (sums [row], row % 7 + 1);
+			XCTAssertEqual (sums [-row - 1], row % 5 + 1);
+		}
+		XCTAssertEqual (sums.sum (of: 0 ..< 1_000), (0 ..< 1_000).reduce (0) { $0 + $1 % 7 + 1 });
+		XCTAssertEqual (sums.sum (of: -1_000 ..< 0), (0 ..< 1_000).reduce (0) { $0 + $1 % 5 + 1 });
+	}
+	
+	func testIndexContainingOffsetMatchesReference () {
+		var sums = FloatingBasePrefixSums <Int> (baseOffset: -200);
+		for index in -200 ..< 200 {
+			// Zero values model rows that are not laid out yet.
+			sums [index] = (index % 11 == 0) ? 0 : self.nextRandomValue (below: 40) + 1;
+		}
+		let indices = sums.indices;
+		
+		for startIndex in stride (from: indices.lowerBound, to: indices.upperBound, by: 13) {
+			let totalSum = sums.sum (of: startIndex ..< indices.upperBound);
+			for offset in [0, 1, totalSum / 3, totalSum / 2, totalSum - 1, totalSum, totalSum + 100] {
+				var expectedIndex = startIndex, sum = 0;
+				for index in startIndex ..< indices.upperBound {
+					sum += sums [index];
+					guard sum <= offset else {
+						break;
+					}
+					expectedIndex = index + 1;
+				}
+				XCTAssertEqual (sums.index (containing: offset, from: startIndex), expectedIndex, "Offset \(offset) from \(startIndex)");
+			}
+		}
+		XCTAssertNil (sums.index (containing: -1, from: 0));
+	}
+	
+	private func nextRandomValue (below upperBound: Int) -> Int {
+		self.randomState = self.randomState &* 6364136223846793005 &+ 1442695040888963407;
+		return Int (self.randomState >> 33) % upperBound;
+	}
+	
+	private func shuffledIndices (in range: Range <Int>) -> [Int] {
+		var result = Array (range);
+		for index in result.indices.reversed () {
+			result.swapAt (index, self.nextRandomValue (below: index + 1));
+		}
+		return result;
+	}
+}
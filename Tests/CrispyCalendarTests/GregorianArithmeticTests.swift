@@ -0,0 +1,135 @@
+//
+//  GregorianArithmeticTests.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import XCTest
+@testable import CrispyCalendar
+
+/// Checks results of arithmetic Gregorian fast paths against `Foundation` calculations.
+final class GregorianArithmeticTests: XCTestCase {
+	private let calendar: Calendar = {
+		var result = Calendar (identifier: .gregorian);
+		result.locale = Locale (identifier: "en_US_POSIX");
+		result.timeZone = guarantee (TimeZone (identifier: "UTC"));
+		return result;
+	} ();
+	
+	/// Dense neighbourhoods of the Julian to Gregorian cutover, of 1970-01-01 and of 2000-02-29, followed by
+	/// a reproducible sample of days from about 1150 BC up to 9796 AD.
+	private let testedDayNumbers: [Int] = {
+		let cutoverDayNumber = CPCGregorianArithmetic.cutoverDayNumber;
+		var result = Array (cutoverDayNumber - 800 ..< cutoverDayNumber + 800) + Array (-800 ..< 800) + Array (10_900 ..< 11_100);
+		var randomState = UInt64 (0x2545F4914F6CDD1D);
+		for _ in 0 ..< 20_000 {
+			randomState = randomState &* 6364136223846793005 &+ 1442695040888963407;
+			result.append (cutoverDayNumber - 1_000_000 + Int (randomState >> 33) % 4_000_000);
+		}
+		return result;
+	} ();
+	
+	func testDaysMatchFoundation () {
+		for dayNumber in self.testedDayNumbers {
+			let expectedDay = CPCDay.BackingStorage (containing: self.calendar.startDate (ofDayNumber: dayNumber), calendar: self.calendar);
+			if (dayNumber < CPCGregorianArithmetic.cutoverDayNumber) {
+				XCTAssertNil (CPCDay.BackingStorage (gregorianDayNumber: dayNumber), "Day \(dayNumber) precedes cutover");
+				XCTAssertNil (expectedDay.gregorianDayNumber, "Julian day \(expectedDay) must not be treated as a Gregorian one");
+			} else {
+				XCTAssertEqual (CPCDay.BackingStorage (gregorianDayNumber: dayNumber), expectedDay, "Day \(dayNumber)");
+				XCTAssertEqual (expectedDay.gregorianDayNumber, dayNumber, "Day \(expectedDay)");
+			}
+			XCTAssertEqual (expectedDay.dayNumber (using: self.calendar.wrapped ()), dayNumber, "Day \(expectedDay)");
+		}
+	}
+	
+	func testDaysAdvancingMatchesFoundation () {
+		let distances = [-146_097, -1_000, -365, -31, -1, 1, 7, 30, 366, 1_000, 146_097];
+		for (index, dayNumber) in self.testedDayNumbers.enumerated () where index % 7 == 0 {
+			let day = CPCDay (containing: self.calendar.startDate (ofDayNumber: dayNumber), calendar: self.calendar);
+			for distance in distances {
+				let expectedDate = guarantee (self.calendar.date (byAdding: .day, value: distance, to: day.start));
+				let expectedDay = CPCDay (containing: expectedDate, calendar: self.calendar);
+				XCTAssertEqual (day.advanced (by: distance), expectedDay, "\(day) advanced by \(distance)");
+				XCTAssertEqual (day.distance (to: expectedDay), distance, "Distance from \(day) to \(expectedDay)");
+			}
+		}
+	}
+	
+	func testMonthsMatchFoundation () {
+		let distances = [-4_800, -13, -12, -1, 1, 11, 12, 25, 4_800];
+		for era in 0 ... 1 {
+			for year in [1, 2, 3, 4, 99, 100, 101, 400, 401, 1581, 1582, 1583, 1970, 2000, 2100, 9999] where (era > 0) || (year < 1582) {
+				for month in 1 ... 12 {
+					let startDate = guarantee (self.calendar.date (from: DateComponents (era: era, year: year, month: month, day: 1)));
+					let unit = CPCMonth (containing: startDate, calendar: self.calendar);
+					for distance in distances {
+						let expectedDate = guarantee (self.calendar.date (byAdding: .month, value: distance, to: startDate));
+						let expectedUnit = CPCMonth (containing: expectedDate, calendar: self.calendar);
+						XCTAssertEqual (unit.advanced (by: distance), expectedUnit, "\(unit) advanced by \(distance)");
+						XCTAssertEqual (unit.distance (to: expectedUnit), distance, "Distance from \(unit) to \(expectedUnit)");
+					}
+				}
+			}
+		}
+	}
+	
+	func testYearsMatchFoundation () {
+		let distances = [-2_000, -400, -100, -4, -2, -1, 1, 2, 4, 100, 400, 2_000];
+		for era in 0 ... 1 {
+			for year in stride (from: 1, through: 3_000, by: 37) where (era > 0) || (year < 2_000) {
+				let startDate = guarantee (self.calendar.date (from: DateComponents (era: era, year: year, month: 1, day: 1)));
+				let unit = CPCYear (containing: startDate, calendar: self.calendar);
+				for distance in distances {
+					let expectedDate = guarantee (self.calendar.date (byAdding: .year, value: distance, to: startDate));
+					let expectedUnit = CPCYear (containing: expectedDate, calendar: self.calendar);
+					XCTAssertEqual (unit.advanced (by: distance), expectedUnit, "\(unit) advanced by \(distance)");
+					XCTAssertEqual (unit.distance (to: expectedUnit), distance, "Distance from \(unit) to \(expectedUnit)");
+				}
+			}
+		}
+	}
+	
+	func testEraBoundary () {
+		let firstYearAD = CPCYear (containing: guarantee (self.calendar.date (from: DateComponents (era: 1, year: 1, month: 6, day: 1))), calendar: self.calendar);
+		let lastYearBC = firstYearAD.advanced (by: -1);
+		XCTAssertEqual (lastYearBC.era, 0);
+		XCTAssertEqual (lastYearBC.year, 1);
+		XCTAssertEqual (lastYearBC.advanced (by: -1).year, 2);
+		XCTAssertEqual (lastYearBC.distance (to: firstYearAD), 1);
+		XCTAssertLessThan (lastYearBC, firstYearAD);
+		
+		let firstMonthAD = firstYearAD [ordinal: 0], lastMonthBC = firstMonthAD.advanced (by: -1);
+		XCTAssertEqual (lastMonthBC.era, 0);
+		XCTAssertEqual (lastMonthBC.year, 1);
+		XCTAssertEqual (lastMonthBC.month, 12);
+		XCTAssertLessThan (lastMonthBC, firstMonthAD);
+	}
+	
+	func testCutover () {
+		let firstGregorianDay = CPCDay (containing: self.calendar.startDate (ofDayNumber: CPCGregorianArithmetic.cutoverDayNumber), calendar: self.calendar);
+		XCTAssertEqual ([firstGregorianDay.era, firstGregorianDay.year, firstGregorianDay.month, firstGregorianDay.day], [1, 1582, 10, 15]);
+		
+		let lastJulianDay = firstGregorianDay.advanced (by: -1);
+		XCTAssertEqual ([lastJulianDay.era, lastJulianDay.year, lastJulianDay.month, lastJulianDay.day], [1, 1582, 10, 4]);
+		XCTAssertEqual (lastJulianDay.distance (to: firstGregorianDay), 1);
+		XCTAssertEqual (lastJulianDay.advanced (by: 1), firstGregorianDay);
+	}
+}
@@ -0,0 +1,84 @@
+//
+//  MetadataTableValidationTests.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+import XCTest
+@testable import CrispyCalendar
+
+/// Checks that metadata tables with inconsistent records are rejected instead of being read out of bounds.
+final class MetadataTableValidationTests: XCTestCase {
+	private let calendar: Calendar = {
+		var result = Calendar (identifier: .buddhist);
+		result.timeZone = guarantee (TimeZone (identifier: "UTC"));
+		return result;
+	}();
+	
+	private lazy var tableData = CPCCalendarMetadataTables.tableData (for: self.calendar, yearOffsets: -1 ... 1);
+	
+	private var yearsOffset: Int {
+		return self.monthsOffset - Int (self.load (UInt32.self, at: 12)) * 24;
+	}
+	
+	private var monthsOffset: Int {
+		return self.tableData.count - Int (self.load (UInt32.self, at: 16)) * 16;
+	}
+	
+	private func load <T> (_ type: T.Type, at offset: Int) -> T where T: FixedWidthInteger {
+		return self.tableData.withUnsafeBytes { T (littleEndian: $0.load (fromByteOffset: offset, as: T.self)) };
+	}
+	
+	private func store <T> (_ value: T, at offset: Int) where T: FixedWidthInteger {
+		var value = value.littleEndian;
+		Swift.withUnsafeBytes (of: &value) { self.tableData.replaceSubrange (offset ..< offset + MemoryLayout <T>.size, with: $0) };
+	}
+	
+	func testGeneratedTableIsAccepted () {
+		XCTAssertNotNil (CPCCalendarMetadataTable (self.tableData, calendar: self.calendar));
+	}
+	
+	func testTruncatedTableIsRejected () {
+		XCTAssertNil (CPCCalendarMetadataTable (self.tableData.dropLast (), calendar: self.calendar));
+		XCTAssertNil (CPCCalendarMetadataTable (self.tableData.prefix (self.monthsOffset), calendar: self.calendar));
+	}
+	
+	func testTableOfAnotherSystemVersionIsRejected () {
+		// Operating system version is the last field of the header, followed by 4 bytes of padding.
+		let majorVersionOffset = self.yearsOffset - 16;
+		self.store (self.load (UInt32.self, at: majorVersionOffset) &+ 1, at: majorVersionOffset);
+		XCTAssertNil (CPCCalendarMetadataTable (self.tableData, calendar: self.calendar));
+	}
+	
+	func testMonthWithInvalidYearIndexIsRejected () {
+		self.store (UInt16.max, at: self.monthsOffset + 4);
+		XCTAssertNil (CPCCalendarMetadataTable (self.tableData, calendar: self.calendar));
+	}
+	
+	func testYearWithInvalidMonthsRangeIsRejected () {
+		self.store (UInt32.max, at: self.yearsOffset + 16);
+		XCTAssertNil (CPCCalendarMetadataTable (self.tableData, calendar: self.calendar));
+	}
+	
+	func testMonthWithoutDaysIsRejected () {
+		self.store (UInt8 (0), at: self.monthsOffset + 8);
+		XCTAssertNil (CPCCalendarMetadataTable (self.tableData, calendar: self.calendar));
+	}
+}
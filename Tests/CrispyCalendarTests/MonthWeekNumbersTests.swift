@@ -0,0 +1,79 @@
+//
+//  MonthWeekNumbersTests.swift
+//  Copyright © 2026 Cleverpumpkin, Ltd. All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+import XCTest
+@testable import CrispyCalendar
+
+/// Checks that week numbers of months follow the same convention whether they are calculated arithmetically,
+/// read from a metadata table or calculated using `Foundation`.
+final class MonthWeekNumbersTests: XCTestCase {
+	private func calendar (_ identifier: Calendar.Identifier, timeZoneIdentifier: String = "UTC") -> Calendar {
+		var result = Calendar (identifier: identifier);
+		result.locale = Locale (identifier: "en_US_POSIX");
+		result.timeZone = guarantee (TimeZone (identifier: timeZoneIdentifier));
+		result.firstWeekday = 1;
+		result.minimumDaysInFirstWeek = 1;
+		return result;
+	}
+	
+	private func months (containing date: Date, calendar: Calendar) -> [CPCMonth] {
+		let month = CPCMonth (containing: date, calendar: calendar);
+		return [month, month.advanced (by: 1)];
+	}
+	
+	private func assertWeekNumbersMatchWeeks (of month: CPCMonth, file: StaticString = #file, line: UInt = #line) {
+		let weekNumbers = Array (month.indicesCache.componentValues);
+		XCTAssertEqual (weekNumbers, month.map { $0.weekNumber }, "\(month)", file: file, line: line);
+		for (ordinal, week) in month.enumerated () {
+			XCTAssertEqual (month.index (of: week), month.index (ordinal: ordinal), "\(week) of \(month)", file: file, line: line);
+		}
+	}
+	
+	func testDecemberAndJanuary () {
+		// Sunday, December 29, 2019 starts the week that contains January 1, 2020.
+		let date = guarantee (DateComponents (calendar: self.calendar (.gregorian), year: 2019, month: 12, day: 15).date);
+		
+		let gregorianMonths = self.months (containing: date, calendar: self.calendar (.gregorian));
+		XCTAssertEqual (Array (gregorianMonths [0].indicesCache.componentValues), [49, 50, 51, 52, 1]);
+		XCTAssertEqual (Array (gregorianMonths [1].indicesCache.componentValues), [1, 2, 3, 4, 5]);
+		
+		let tableCalendar = self.calendar (.buddhist), tableCalendarWrapper = tableCalendar.wrapped ();
+		let table = guarantee (CPCCalendarMetadataTable (CPCCalendarMetadataTables.tableData (for: tableCalendar, yearOffsets: -10 ... 10), calendar: tableCalendar));
+		tableCalendarWrapper.metadataTableState.withMutableStoredValue { $0 = .loaded (table) };
+		let tableMonths = self.months (containing: date, calendar: tableCalendar);
+		
+		let foundationCalendar = self.calendar (.buddhist, timeZoneIdentifier: "GMT"), foundationCalendarWrapper = foundationCalendar.wrapped ();
+		foundationCalendarWrapper.metadataTableState.withMutableStoredValue { $0 = .generating };
+		let foundationMonths = self.months (containing: date, calendar: foundationCalendar);
+		
+		for (index, gregorianMonth) in gregorianMonths.enumerated () {
+			self.assertWeekNumbersMatchWeeks (of: gregorianMonth);
+			self.assertWeekNumbersMatchWeeks (of: tableMonths [index]);
+			self.assertWeekNumbersMatchWeeks (of: foundationMonths [index]);
+			XCTAssertEqual (tableMonths [index].indicesCache.componentValues, gregorianMonth.indicesCache.componentValues);
+			XCTAssertEqual (foundationMonths [index].indicesCache.componentValues, gregorianMonth.indicesCache.componentValues);
+		}
+		withExtendedLifetime ((tableCalendarWrapper, foundationCalendarWrapper)) {};
+	}
+}